@@ -0,0 +1,83 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include <string>
+
+#include <lexy/dsl.hpp>
+#include <lexy/input/buffer.hpp>
+#include <lexy/match.hpp>
+
+namespace
+{
+namespace dsl = lexy::dsl;
+
+struct record_kind;
+} // namespace
+
+// The profile as written by `lexy_ext::write_choice_profile()` after parsing a sample log:
+// almost all records are of the 14th kind.
+template <>
+struct lexy::choice_profile<record_kind>
+{
+    static constexpr std::uint64_t hits[]
+        = {12, 3, 40, 7, 1, 0, 2, 5, 9, 4, 11, 6, 8, 9000, 15, 10};
+};
+
+namespace
+{
+// A log where each line is a record of one of 16 kinds.
+constexpr auto records = [] {
+    auto record = [](auto kind) { return kind >> dsl::lit_c<' '> + dsl::digits<> + dsl::newline; };
+    return record(LEXY_LIT("alpha")) | record(LEXY_LIT("bravo")) | record(LEXY_LIT("charlie"))
+           | record(LEXY_LIT("delta")) | record(LEXY_LIT("echo")) | record(LEXY_LIT("foxtrot"))
+           | record(LEXY_LIT("golf")) | record(LEXY_LIT("hotel")) | record(LEXY_LIT("india"))
+           | record(LEXY_LIT("juliet")) | record(LEXY_LIT("kilo")) | record(LEXY_LIT("lima"))
+           | record(LEXY_LIT("mike")) | record(LEXY_LIT("november")) | record(LEXY_LIT("oscar"))
+           | record(LEXY_LIT("papa"));
+}();
+
+struct log_source_order
+{
+    static constexpr auto rule = dsl::while_(records) + dsl::eof;
+};
+
+struct log_profiled
+{
+    static constexpr auto rule = dsl::while_(dsl::profiled_choice<record_kind>(records)) + dsl::eof;
+};
+
+auto log_data(std::size_t lines)
+{
+    const char* kinds[]
+        = {"alpha", "bravo",  "charlie", "delta", "echo", "foxtrot",  "golf",  "hotel",
+           "india", "juliet", "kilo",    "lima",  "mike", "november", "oscar", "papa"};
+
+    std::string str;
+    for (auto i = std::size_t(0); i != lines; ++i)
+    {
+        str += i % 10 == 0 ? kinds[i / 10 % 16] : "november";
+        str += ' ';
+        str += std::to_string(i);
+        str += '\n';
+    }
+
+    return lexy::buffer<lexy::utf8_encoding>(str.data(), str.size());
+}
+} // namespace
+
+int main()
+{
+    auto data = log_data(256 * 1024);
+
+    ankerl::nanobench::Bench b;
+    b.title("profiled choice").relative(true);
+    b.unit("byte").batch(data.size());
+    b.minEpochIterations(10);
+
+    b.run("source order", [&] { return lexy::match<log_source_order>(data); });
+    b.run("profiled", [&] { return lexy::match<log_profiled>(data); });
+}
@@ -0,0 +1,97 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <lexy/dsl.hpp>
+#include <lexy/input/file.hpp>
+#include <lexy/validate.hpp>
+#include <lexy_ext/validate_corpus.hpp>
+
+namespace
+{
+namespace dsl = lexy::dsl;
+
+// A line based format of comma separated integers.
+struct record
+{
+    static constexpr auto rule = list(dsl::digits<>, dsl::sep(dsl::comma)) + dsl::newline;
+};
+struct document
+{
+    static constexpr auto rule = dsl::terminator(dsl::eof).opt_list(dsl::p<record>);
+};
+
+constexpr auto bm_corpus_dir = "bm-corpus.delete-me";
+
+// Generates `count` files, where every 64th file is big and the others are small.
+std::vector<std::string> write_corpus(std::size_t count)
+{
+    std::filesystem::create_directory(bm_corpus_dir);
+
+    std::vector<std::string> paths;
+    for (auto i = std::size_t(0); i != count; ++i)
+    {
+        auto path = std::string(bm_corpus_dir) + "/" + std::to_string(i) + ".txt";
+        paths.push_back(path);
+
+        std::ofstream out(path, std::ios::binary);
+        auto          lines = i % 64 == 0 ? 64 * 1024 : 16 + i % 128;
+        for (auto line = std::size_t(0); line != lines; ++line)
+            out << line << ',' << line * i << ',' << i << '\n';
+    }
+    return paths;
+}
+
+std::size_t corpus_serial(const std::vector<std::string>& paths)
+{
+    std::size_t errors = 0;
+    for (auto& path : paths)
+    {
+        auto file = lexy::read_file(path.c_str());
+        errors += lexy::validate<document>(file, lexy::noop).error_count();
+    }
+    return errors;
+}
+
+std::size_t corpus_parallel(const std::vector<std::string>& paths, unsigned threads)
+{
+    std::size_t errors = 0;
+    for (auto& result : lexy_ext::validate_corpus<document>(paths, lexy::noop, {threads}))
+        errors += result.result().error_count();
+    return errors;
+}
+} // namespace
+
+int main()
+{
+    auto paths = write_corpus(1024);
+
+    std::uintmax_t total_size = 0;
+    for (auto& path : paths)
+        total_size += std::filesystem::file_size(path);
+
+    ankerl::nanobench::Bench b;
+    b.title("validate corpus").relative(true);
+    b.unit("byte").batch(total_size);
+    b.minEpochIterations(3);
+
+    b.run("serial", [&] { return corpus_serial(paths); });
+    b.run("validate_corpus (1 thread)", [&] { return corpus_parallel(paths, 1); });
+    for (auto threads = 2u; threads <= std::thread::hardware_concurrency(); threads *= 2)
+    {
+        auto name = "validate_corpus (" + std::to_string(threads) + " threads)";
+        b.run(name, [&] { return corpus_parallel(paths, threads); });
+    }
+    b.run("validate_corpus (all threads)", [&] { return corpus_parallel(paths, 0); });
+
+    std::filesystem::remove_all(bm_corpus_dir);
+}
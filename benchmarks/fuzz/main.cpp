@@ -0,0 +1,51 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+std::size_t json_regression(const std::string& data);
+std::size_t xml_regression(const std::string& data);
+std::size_t email_regression(const std::string& data);
+std::size_t shell_regression(const std::string& data);
+
+namespace
+{
+// Benchmarks every input the fuzzer has saved for the grammar.
+template <typename Fn>
+void bm_regressions(const char* grammar, Fn fn)
+{
+    auto dir = std::filesystem::path(LEXY_FUZZ_REGRESSION_DIR) / grammar;
+    if (!std::filesystem::is_directory(dir))
+        return;
+
+    ankerl::nanobench::Bench b;
+    b.title(grammar);
+    b.unit("byte");
+    b.minEpochIterations(3);
+
+    for (auto& entry : std::filesystem::directory_iterator(dir))
+    {
+        std::ifstream file(entry.path(), std::ios::binary);
+        std::string   data((std::istreambuf_iterator<char>(file)),
+                         std::istreambuf_iterator<char>());
+
+        b.batch(data.size());
+        b.run(entry.path().filename().string(), [&] { return fn(data); });
+    }
+}
+} // namespace
+
+int main()
+{
+    bm_regressions("json", json_regression);
+    bm_regressions("xml", xml_regression);
+    bm_regressions("email", email_regression);
+    bm_regressions("shell", shell_regression);
+}
@@ -0,0 +1,16 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/input/string_input.hpp>
+#include <lexy/validate.hpp>
+#include <string>
+
+#define LEXY_TEST
+#include "../../examples/xml.cpp"
+
+std::size_t xml_regression(const std::string& data)
+{
+    auto input = lexy::string_input<lexy::utf8_encoding>(data.data(), data.size());
+    return lexy::validate<grammar::document>(input, lexy::noop).error_count();
+}
@@ -0,0 +1,72 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include <lexy/input/file.hpp>
+
+bool json_lexy(const lexy::buffer<lexy::utf8_encoding>& input);
+bool xml_lexy(const lexy::buffer<lexy::utf8_encoding>& input);
+
+namespace
+{
+auto get_data(const char* file_name)
+{
+    auto path   = std::string(LEXY_BENCHMARK_DATA) + "/" + file_name;
+    auto result = lexy::read_file<lexy::utf8_encoding>(path.c_str());
+    if (!result)
+        throw std::runtime_error("unable to read data file");
+    return lexy::buffer<lexy::utf8_encoding>(result.data(), result.size());
+}
+
+// Generates a catalog with nested elements, text, references, comments and CDATA sections.
+auto xml_data(std::size_t items)
+{
+    std::string str = "<!-- generated -->\n<catalog>\n";
+    for (auto i = std::size_t(0); i != items; ++i)
+    {
+        str += "  <item>\n";
+        str += "    <name>Item &lt;" + std::to_string(i) + "&gt;</name>\n";
+        str += "    <price>" + std::to_string(i * 7 % 1000) + ".99</price>\n";
+        str += "    <tags><tag>a</tag><tag>b &amp; c</tag><empty/></tags>\n";
+        if (i % 8 == 0)
+            str += "    <!-- a comment --><![CDATA[raw <data> & stuff]]>\n";
+        str += "  </item>\n";
+    }
+    str += "</catalog>\n";
+
+    return lexy::buffer<lexy::utf8_encoding>(str.data(), str.size());
+}
+} // namespace
+
+// Run the executable of every policy and compare the results.
+// The executables only differ in the parsing code of the grammars, so the difference in their size
+// is the difference in code size.
+int main(int, char* argv[])
+{
+    std::printf("LEXY_INLINE_POLICY: %s\n", LEXY_BENCHMARK_POLICY);
+    std::printf("executable size: %ju bytes\n\n",
+                static_cast<std::uintmax_t>(std::filesystem::file_size(argv[0])));
+
+    ankerl::nanobench::Bench b;
+    b.minEpochIterations(10);
+
+    auto bench = [&](const char* name, const lexy::buffer<lexy::utf8_encoding>& data, auto fn) {
+        b.unit("byte").batch(data.size());
+        b.run(name, [&] { return fn(data); });
+    };
+
+    b.title(std::string("inline policy: ") + LEXY_BENCHMARK_POLICY);
+    bench("json: canada.json", get_data("canada.json"), json_lexy);
+    bench("json: citm_catalog.json", get_data("citm_catalog.json"), json_lexy);
+    bench("json: twitter.json", get_data("twitter.json"), json_lexy);
+    bench("xml: catalog", xml_data(16 * 1024), xml_lexy);
+}
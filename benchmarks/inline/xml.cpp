@@ -0,0 +1,14 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/input/file.hpp>
+#include <lexy/parse.hpp>
+
+#define LEXY_TEST
+#include "../../examples/xml.cpp"
+
+bool xml_lexy(const lexy::buffer<lexy::utf8_encoding>& input)
+{
+    return lexy::parse<grammar::document>(input, lexy::noop).is_success();
+}
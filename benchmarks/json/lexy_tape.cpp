@@ -0,0 +1,15 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/input/file.hpp>
+
+#define LEXY_TEST
+#include "../../examples/json_tape.cpp"
+
+bool json_lexy_tape(const lexy::buffer<lexy::utf8_encoding>& input)
+{
+    // Like a simdjson parser, the tape is reused, so its memory is only allocated once.
+    static tape::json_tape tape;
+    return parse_json(tape, input, lexy::noop).is_success();
+}
@@ -9,6 +9,7 @@
 
 bool json_baseline(const lexy::buffer<lexy::utf8_encoding>& input);
 bool json_lexy(const lexy::buffer<lexy::utf8_encoding>& input);
+bool json_lexy_tape(const lexy::buffer<lexy::utf8_encoding>& input);
 bool json_pegtl(const lexy::buffer<lexy::utf8_encoding>& input);
 bool json_nlohmann(const lexy::buffer<lexy::utf8_encoding>& input);
 bool json_rapid(const lexy::buffer<lexy::utf8_encoding>& input);
@@ -33,6 +34,7 @@ const char* output_prefix()
 This benchmark measures the time it takes to *validate* JSON, i.e. to check whether it is well-formed.
 Validation was chosen as opposed to parsing, as parsing speed depends on the JSON data structure as well.
 Implementing an efficient JSON container is out of scope for lexy, so it would have a disadvantage over the specialized JSON libraries.
+The only exception is `lexy (tape)`, which fully parses the JSON into the flat representation of the tape example.
 
 The average validation times for each input are shown in the boxplots below.
 Lower values are better.
@@ -77,6 +79,10 @@ const char* output_suffix()
     This simply adds all input characters of the JSON document without performing actual validation.
 `lexy`::
     A JSON validator using the lexy grammar from the example.
+`lexy (tape)`::
+    A JSON parser using the lexy grammar from the tape example.
+    It stores all values in a single array of tagged 64-bit entries, with strings referring to the input.
+    The tape is reused between runs, so it does not allocate once it has grown large enough.
 `pegtl`::
     A JSON validator using the https://github.com/taocpp/PEGTL[PEGTL] JSON grammar.
 `nlohmann/json`::
@@ -118,6 +124,7 @@ int main()
 
         b.run("baseline", [&] { return json_baseline(data); });
         b.run("lexy", [&] { return json_lexy(data); });
+        b.run("lexy (tape)", [&] { return json_lexy_tape(data); });
         b.run("pegtl", [&] { return json_pegtl(data); });
         b.run("nlohmann/json", [&] { return json_nlohmann(data); });
         b.run("rapidjson", [&] { return json_rapid(data); });
@@ -0,0 +1,115 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include <lexy/huge_page_resource.hpp>
+#include <lexy/input/buffer.hpp>
+#include <lexy/parse_tree.hpp>
+
+#define LEXY_TEST
+#include "../../examples/json.cpp"
+
+namespace
+{
+// Generates an array of objects, about `size` bytes in total.
+std::string json_data(std::size_t size)
+{
+    std::string str = "[\n";
+    for (auto i = std::size_t(0); str.size() < size; ++i)
+    {
+        if (i > 0)
+            str += ",\n";
+        str += R"(  {"id": )" + std::to_string(i);
+        str += R"(, "name": "item )" + std::to_string(i) + R"(", "price": )";
+        str += std::to_string(i * 7 % 1000) + ".99";
+        str += R"(, "tags": ["a", "b", "c"], "available": true, "parent": null})";
+    }
+    str += "\n]\n";
+    return str;
+}
+
+template <typename Tree>
+std::size_t count_tokens(const Tree& tree)
+{
+    auto result = std::size_t(0);
+    for (auto [event, node] : tree.traverse())
+        if (event == lexy::traverse_event::leaf)
+            result += node.lexeme().size();
+    return result;
+}
+
+// Trees that use the huge page resource get their own one.
+template <typename Tree>
+Tree make_tree(lexy::huge_page_resource& resource)
+{
+    if constexpr (std::is_constructible_v<Tree, lexy::huge_page_resource*>)
+        return Tree(&resource);
+    else
+        return Tree();
+}
+
+template <typename Tree, typename Input>
+void bm_construction(ankerl::nanobench::Bench& b, const char* name, const Input& input)
+{
+    b.run(name, [&] {
+        // A fresh resource for every tree, so mapping the memory is part of the construction.
+        lexy::huge_page_resource resource;
+
+        auto tree = make_tree<Tree>(resource);
+        lexy::parse_as_tree<grammar::json>(tree, input, lexy::noop);
+        return tree.empty();
+    });
+}
+
+template <typename Tree, typename Input>
+void bm_traversal(ankerl::nanobench::Bench& b, const char* name, const Input& input)
+{
+    lexy::huge_page_resource resource;
+
+    auto tree = make_tree<Tree>(resource);
+    lexy::parse_as_tree<grammar::json>(tree, input, lexy::noop);
+    b.run(name, [&] { return count_tokens(tree); });
+
+    if (resource.mapped_bytes() > 0)
+        std::printf("%s: %zu bytes mapped, %zu bytes backed by huge pages\n", name,
+                    resource.mapped_bytes(), resource.huge_page_bytes());
+}
+} // namespace
+
+// The size of the input in MiB can be passed as argument.
+int main(int argc, char* argv[])
+{
+    auto size = std::size_t(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 64) * 1024 * 1024;
+    auto data = json_data(size);
+
+    using default_buffer = lexy::buffer<lexy::utf8_encoding>;
+    using huge_buffer    = lexy::buffer<lexy::utf8_encoding, lexy::huge_page_resource>;
+    using huge_tree      = lexy::parse_tree_for<huge_buffer, void, lexy::huge_page_resource>;
+    using compact_tree = lexy::compact_parse_tree_for<huge_buffer, void, lexy::huge_page_resource>;
+
+    lexy::huge_page_resource input_resource;
+    auto default_input = default_buffer(data.data(), data.size());
+    auto huge_input    = huge_buffer(data.data(), data.size(), &input_resource);
+    std::printf("input: %zu bytes, %zu bytes backed by huge pages\n\n", data.size(),
+                input_resource.huge_page_bytes());
+
+    ankerl::nanobench::Bench b;
+    b.unit("byte").batch(data.size()).minEpochIterations(3).relative(true);
+
+    b.title("construction");
+    bm_construction<lexy::parse_tree_for<default_buffer>>(b, "default", default_input);
+    bm_construction<huge_tree>(b, "huge pages", huge_input);
+    bm_construction<compact_tree>(b, "huge pages, compact", huge_input);
+
+    b.title("traversal");
+    bm_traversal<lexy::parse_tree_for<default_buffer>>(b, "default", default_input);
+    bm_traversal<huge_tree>(b, "huge pages", huge_input);
+    bm_traversal<compact_tree>(b, "huge pages, compact", huge_input);
+}
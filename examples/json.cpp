@@ -5,15 +5,21 @@
 #include <cinttypes>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <iterator>
 #include <map>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <variant>
 #include <vector>
 
 #include <lexy/dsl.hpp>        // lexy::dsl::*
-#include <lexy/input/file.hpp> // lexy::read_file
-#include <lexy/parse.hpp>      // lexy::parse
+#include <lexy/input/file.hpp>        // lexy::read_file
+#include <lexy/input/range_input.hpp> // lexy::range_input
+#include <lexy/parse.hpp>             // lexy::parse
+#include <lexy/validate.hpp>          // lexy::validate
 
 #include <lexy_ext/report_error.hpp> // lexy_ext::report_error
 
@@ -297,6 +303,490 @@ struct json
 };
 } // namespace grammar
 
+// Reports the JSON document as events instead of building the AST, see `lexy::parse_events()`.
+// Only the nesting of the document is kept in memory.
+namespace events
+{
+// The Handler has the member functions `start_object()`, `key(lexeme)`, `end_object()`,
+// `start_array()`, `end_array()`, and `value(lexeme)`.
+// All lexemes point into the input: keys are without quotes, values are the JSON text,
+// i.e. strings are quoted; escape sequences are not replaced.
+template <typename Handler>
+class json_visitor
+{
+public:
+    explicit json_visitor(Handler& handler) : _handler(&handler), _in_value(false) {}
+
+    void start(grammar::json_value)
+    {
+        _in_value = true;
+    }
+
+    void start(grammar::object)
+    {
+        _in_value = false;
+        _handler->start_object();
+    }
+    template <typename Lexeme>
+    void finish(grammar::object, Lexeme)
+    {
+        _handler->end_object();
+    }
+
+    void start(grammar::array)
+    {
+        _in_value = false;
+        _handler->start_array();
+    }
+    template <typename Lexeme>
+    void finish(grammar::array, Lexeme)
+    {
+        _handler->end_array();
+    }
+
+    template <typename Lexeme>
+    void finish(grammar::string, Lexeme lexeme)
+    {
+        // A string that isn't the value itself is the key of an object item.
+        if (!_in_value)
+            _handler->key(Lexeme(std::next(lexeme.begin()), std::prev(lexeme.end())));
+    }
+
+    template <typename Lexeme>
+    void finish(grammar::json_value, Lexeme lexeme)
+    {
+        // Objects and arrays have already been reported.
+        if (!_in_value)
+            return;
+        _in_value = false;
+
+        // The lexeme includes the whitespace after the value.
+        auto end = lexeme.end();
+        while (end != lexeme.begin())
+        {
+            auto c = *std::prev(end);
+            if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+                break;
+            --end;
+        }
+        _handler->value(Lexeme(lexeme.begin(), end));
+    }
+
+private:
+    Handler* _handler;
+    // Whether we're currently inside a value that isn't an object or array.
+    bool     _in_value;
+};
+} // namespace events
+
+// Extracts only the values at the queried paths: everything else is skipped without parsing it.
+namespace query
+{
+// A set of paths like `/user/id` or `/items/*/price`, stored as a trie.
+// A segment is either the key of an object item, with escape sequences replaced, or the index of
+// an array element; `*` matches every item or element.
+class path_set
+{
+public:
+    path_set() : _nodes(1) {}
+
+    // Adds a path and returns its index.
+    std::size_t add(std::string_view path)
+    {
+        auto cur = std::size_t(0);
+        while (!path.empty())
+        {
+            // Skip the leading slash.
+            if (path.front() == '/')
+                path.remove_prefix(1);
+
+            auto end     = path.find('/');
+            auto segment = path.substr(0, end);
+            path         = end == std::string_view::npos ? std::string_view() : path.substr(end);
+
+            auto& children = _nodes[cur].children;
+            auto  iter     = children.find(segment);
+            if (iter == children.end())
+            {
+                iter = children.emplace(std::string(segment), _nodes.size()).first;
+                _nodes.emplace_back();
+            }
+            cur = iter->second;
+        }
+
+        _nodes[cur].paths.push_back(_path_count);
+        return _path_count++;
+    }
+
+    // The number of paths.
+    std::size_t size() const
+    {
+        return _path_count;
+    }
+
+    //=== trie access ===//
+    static constexpr std::size_t root = 0;
+
+    // Invokes f with every child of the node that matches the key.
+    template <typename Fn>
+    void for_each_child(std::size_t node, std::string_view key, Fn f) const
+    {
+        auto& children = _nodes[node].children;
+        if (auto iter = children.find(key); iter != children.end())
+            f(iter->second);
+        if (auto iter = children.find("*"); iter != children.end() && key != "*")
+            f(iter->second);
+    }
+
+    bool has_children(std::size_t node) const
+    {
+        return !_nodes[node].children.empty();
+    }
+
+    // The indices of the paths that end at the node.
+    const std::vector<std::size_t>& paths(std::size_t node) const
+    {
+        return _nodes[node].paths;
+    }
+
+private:
+    struct node
+    {
+        std::map<std::string, std::size_t, std::less<>> children;
+        std::vector<std::size_t>                         paths;
+    };
+
+    std::vector<node> _nodes;
+    std::size_t       _path_count = 0;
+};
+
+// Skips values by searching through the memory of the input for the few characters that matter,
+// instead of matching every character with the DSL.
+// Outside of strings, only brackets are looked at, so the skipped values aren't validated.
+namespace skip
+{
+// Returns the first occurrence of c in [cur, end), or end.
+template <typename CharT>
+const CharT* find(const CharT* cur, const CharT* end, char c)
+{
+    auto result = std::memchr(cur, c, std::size_t(end - cur));
+    return result == nullptr ? end : static_cast<const CharT*>(result);
+}
+
+// Returns the end of the string starting at cur, or nullptr if there is none.
+template <typename CharT>
+const CharT* string(const CharT* cur, const CharT* end)
+{
+    if (cur == end || *cur != '"')
+        return nullptr;
+
+    // Strings can be long, so we search for the next quote in bulk.
+    auto begin = cur + 1;
+    for (auto quote = skip::find(begin, end, '"'); quote != end;
+         quote      = skip::find(quote + 1, end, '"'))
+    {
+        // The quote is escaped if it's preceded by an odd number of backslashes.
+        auto backslash = quote;
+        while (backslash != begin && backslash[-1] == '\\')
+            --backslash;
+        if ((quote - backslash) % 2 == 0)
+            return quote + 1;
+    }
+    return nullptr;
+}
+
+// Returns the end of the object or array starting at cur, or nullptr if there is none.
+template <typename CharT>
+const CharT* container(const CharT* cur, const CharT* end)
+{
+    // Outside of strings, there are only a few characters between the brackets and quotes,
+    // so a simple loop is fastest.
+    auto depth = 0;
+    while (cur != end)
+    {
+        auto c = *cur;
+        if (c == '"')
+        {
+            cur = skip::string(cur, end);
+            if (cur == nullptr)
+                return nullptr;
+            continue;
+        }
+
+        ++cur;
+        if (c == '{' || c == '[')
+            ++depth;
+        else if ((c == '}' || c == ']') && --depth == 0)
+            return cur;
+    }
+    return nullptr;
+}
+
+// Returns the end of the value starting at cur, or nullptr if there is none.
+template <typename CharT>
+const CharT* value(const CharT* cur, const CharT* end)
+{
+    if (cur == end)
+        return nullptr;
+    else if (*cur == '"')
+        return skip::string(cur, end);
+    else if (*cur == '{' || *cur == '[')
+        return skip::container(cur, end);
+
+    // A number, `true`, `false` or `null`.
+    auto is_primitive = [](auto c) {
+        return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')
+               || c == '-' || c == '+' || c == '.';
+    };
+    auto primitive_end = cur;
+    while (primitive_end != end && is_primitive(*primitive_end))
+        ++primitive_end;
+    return primitive_end == cur ? nullptr : primitive_end;
+}
+} // namespace skip
+
+// The parse state of a single level.
+template <typename Extractor, typename Iterator>
+struct level_state
+{
+    Extractor*  extractor;
+    std::size_t node;
+    std::size_t index; // The index of the next array element.
+    Iterator    end;   // The end of the input, needed to skip the items.
+};
+
+// Grammar that parses a single object or array of the document.
+// Its items aren't parsed, they're only skipped and passed to the extractor as lexemes.
+namespace grammar
+{
+namespace dsl = lexy::dsl;
+
+// Skips a string or any value and produces its lexeme.
+// It expects the level_state as the first value, as it needs the end of the input.
+template <bool StringOnly>
+struct _skip : dsl::rule_base
+{
+    template <typename NextParser>
+    struct parser
+    {
+        template <typename Context, typename Reader, typename State, typename... Args>
+        static bool parse(Context& context, Reader& reader, State& state, Args&&... args)
+        {
+            auto begin = reader.cur();
+            auto end   = StringOnly ? skip::string(begin, state.end)
+                                    : skip::value(begin, state.end);
+            if (end == nullptr)
+            {
+                auto name = StringOnly ? "string" : "value";
+                auto err  = lexy::make_error<Reader, lexy::expected_char_class>(begin, name);
+                context.error(err);
+                return false;
+            }
+
+            while (reader.cur() != end)
+                reader.bump();
+
+            using continuation = lexy::whitespace_parser<Context, NextParser>;
+            return continuation::parse(context, reader, state, std::forward<Args>(args)...,
+                                       lexy::lexeme<Reader>(begin, end));
+        }
+    };
+};
+
+constexpr auto skip_string = _skip<true>{};
+constexpr auto skip_value  = _skip<false>{};
+
+struct member
+{
+    static constexpr auto rule = dsl::parse_state + skip_string + dsl::colon + skip_value;
+    static constexpr auto value
+        = lexy::callback([](auto& state, auto key, auto value) {
+              state.extractor->member(state, key, value);
+          });
+};
+
+struct element
+{
+    static constexpr auto rule  = dsl::parse_state + skip_value;
+    static constexpr auto value = lexy::callback(
+        [](auto& state, auto value) { state.extractor->element(state, value); });
+};
+
+struct object
+{
+    static constexpr auto rule
+        = dsl::curly_bracketed.opt_list(dsl::p<member>, dsl::sep(dsl::comma));
+    static constexpr auto value = lexy::noop;
+};
+
+struct array
+{
+    static constexpr auto rule
+        = dsl::square_bracketed.opt_list(dsl::p<element>, dsl::sep(dsl::comma));
+    static constexpr auto value = lexy::noop;
+};
+
+struct level
+{
+    static constexpr auto whitespace = ::grammar::json::whitespace;
+
+    static constexpr auto rule  = dsl::whitespace + (dsl::p<object> | dsl::p<array>) + dsl::eof;
+    static constexpr auto value = lexy::noop;
+};
+} // namespace grammar
+
+// Walks the document along the paths.
+// Each object or array on a path is skipped by its parent first, and then parsed one level at a
+// time; only the queried values are parsed completely, and their children are taken from the
+// result.
+template <typename Encoding, typename Iterator, typename Callback, typename ErrorCallback>
+class extractor
+{
+public:
+    using state = level_state<extractor, Iterator>;
+
+    explicit extractor(const path_set& paths, bool validate_skipped, Callback& callback,
+                       const ErrorCallback& error_callback)
+    : _paths(&paths), _callback(&callback), _error_callback(&error_callback),
+      _validate_skipped(validate_skipped), _success(true)
+    {}
+
+    // The value of the node is the entire input.
+    template <typename Input>
+    void value(std::size_t node, const Input& input)
+    {
+        if (!_paths->paths(node).empty())
+        {
+            // The value is queried, so we parse it completely.
+            auto result = lexy::parse<::grammar::json>(input, *_error_callback);
+            if (result)
+                _parsed(node, result.value());
+            else
+                _success = false;
+        }
+        else if (_paths->has_children(node) && _is_container(input.begin(), input.end()))
+        {
+            // Parse one level of the value to look for the children of the node.
+            auto level  = state{this, node, 0, input.end()};
+            auto result = lexy::parse<grammar::level>(input, level, *_error_callback);
+            _success    = _success && static_cast<bool>(result);
+        }
+        else if (_validate_skipped)
+        {
+            auto result = lexy::validate<::grammar::json>(input, *_error_callback);
+            _success    = _success && result.is_success();
+        }
+    }
+
+    bool success() const
+    {
+        return _success;
+    }
+
+    //=== callbacks of the grammar ===//
+    template <typename Key, typename Value>
+    void member(state& level, Key key, Value value)
+    {
+        // The key is always a string, i.e. quoted.
+        auto key_str = std::string_view(reinterpret_cast<const char*>(key.data()), key.size());
+        if (key_str.find('\\') == std::string_view::npos)
+        {
+            _item(level.node, key_str.substr(1, key_str.size() - 2), value);
+            return;
+        }
+
+        // Replace the escape sequences, so the key matches the ones of parsed objects.
+        auto input  = lexy::range_input<Encoding, Iterator>(key.begin(), key.end());
+        auto result = lexy::parse<::grammar::string>(input, *_error_callback);
+        if (result)
+            _item(level.node, result.value(), value);
+        else
+            _success = false;
+    }
+
+    template <typename Value>
+    void element(state& level, Value value)
+    {
+        auto index = std::to_string(level.index++);
+        _item(level.node, index, value);
+    }
+
+private:
+    template <typename Value>
+    void _item(std::size_t node, std::string_view key, Value value)
+    {
+        auto input   = lexy::range_input<Encoding, Iterator>(value.begin(), value.end());
+        auto matched = false;
+        _paths->for_each_child(node, key, [&](std::size_t child) {
+            matched = true;
+            this->value(child, input);
+        });
+
+        if (!matched && _validate_skipped)
+        {
+            auto result = lexy::validate<::grammar::json>(input, *_error_callback);
+            _success    = _success && result.is_success();
+        }
+    }
+
+    // Reports the paths of the node and looks for its children in the parsed value.
+    void _parsed(std::size_t node, const ast::json_value& value)
+    {
+        for (auto path : _paths->paths(node))
+            (*_callback)(path, value);
+        if (!_paths->has_children(node))
+            return;
+
+        if (auto object = std::get_if<ast::json_object>(&value.v))
+        {
+            for (auto& [key, item] : *object)
+                _paths->for_each_child(node, key, [&](std::size_t child) { _parsed(child, item); });
+        }
+        else if (auto array = std::get_if<ast::json_array>(&value.v))
+        {
+            for (auto index = std::size_t(0); index != array->size(); ++index)
+                _paths->for_each_child(node, std::to_string(index), [&](std::size_t child) {
+                    _parsed(child, (*array)[index]);
+                });
+        }
+    }
+
+    static bool _is_container(Iterator begin, Iterator end)
+    {
+        auto is_space = [](auto c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; };
+        while (begin != end && is_space(*begin))
+            ++begin;
+        return begin != end && (*begin == '{' || *begin == '[');
+    }
+
+    const path_set*      _paths;
+    Callback*            _callback;
+    const ErrorCallback* _error_callback;
+    bool                 _validate_skipped;
+    bool                 _success;
+};
+
+// Invokes `callback(path_index, json_value)` for each value that is at one of the paths.
+// Everything else is only skipped, unless `validate_skipped` is true; then it's validated as well.
+// The input must be contiguous memory of single bytes with `begin()` and `end()`, like a buffer,
+// string input or range input.
+// Returns whether the input was well-formed.
+template <typename Input, typename Callback, typename ErrorCallback>
+bool extract(const Input& input, const path_set& paths, bool validate_skipped, Callback callback,
+             const ErrorCallback& error_callback)
+{
+    using encoding = typename Input::encoding;
+    using iterator = typename lexy::input_reader<Input>::iterator;
+    static_assert(std::is_pointer_v<iterator> && sizeof(typename encoding::char_type) == 1,
+                  "input must be contiguous memory of single bytes");
+
+    auto extract = extractor<encoding, iterator, Callback, ErrorCallback>(paths, validate_skipped,
+                                                                         callback, error_callback);
+    extract.value(path_set::root, input);
+    return extract.success();
+}
+} // namespace query
+
 #ifndef LEXY_TEST
 int main(int argc, char** argv)
 {
@@ -0,0 +1,584 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <cctype>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <lexy/dsl.hpp>        // lexy::dsl::*
+#include <lexy/input/file.hpp> // lexy::read_file
+#include <lexy/parse.hpp>      // lexy::parse
+
+#include <lexy_ext/report_error.hpp> // lexy_ext::report_error
+
+// A flat representation of JSON that doesn't need an allocation per value.
+// Like the one of simdjson, all values are stored in a single array of 64-bit entries (the tape):
+// the upper 8 bits are a tag and the lower 56 bits the payload.
+namespace tape
+{
+enum class tag : std::uint8_t
+{
+    null   = 'n',
+    true_  = 't',
+    false_ = 'f',
+    // The payload is unused, the next entry stores the value.
+    integer = 'l',
+    real    = 'd',
+    // The payload is an offset into the input, the next entry the length.
+    string = '"',
+    // The payload is an offset into the string arena of the tape, the next entry the length.
+    escaped_string = '\\',
+    // The payload of the begin entry is the index of the end entry (lower 32 bits) and the number
+    // of elements (upper 24 bits, saturated); the payload of the end entry the index of the begin
+    // entry. Objects contain alternating string and value entries.
+    array_begin  = '[',
+    array_end    = ']',
+    object_begin = '{',
+    object_end   = '}',
+};
+
+class json_tape
+{
+public:
+    //=== building ===//
+    // Prepares the tape for parsing a new input, which must be contiguous memory.
+    // The memory of the previous parse is reused.
+    template <typename Input>
+    void reset(const Input& input)
+    {
+        _input = reinterpret_cast<const char*>(input.reader().cur());
+        _entries.clear();
+        _strings.clear();
+    }
+
+    // All functions return the index of the (first) entry they've pushed.
+    std::size_t push_literal(tag t)
+    {
+        return _push(t, 0);
+    }
+
+    std::size_t push_integer(std::int64_t value)
+    {
+        auto idx = _push(tag::integer, 0);
+        _entries.push_back(static_cast<std::uint64_t>(value));
+        return idx;
+    }
+
+    std::size_t push_real(double value)
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        auto idx = _push(tag::real, 0);
+        _entries.push_back(bits);
+        return idx;
+    }
+
+    // Pushes a string that is part of the input.
+    std::size_t push_string(std::string_view str)
+    {
+        auto offset = str.empty() ? 0 : static_cast<std::uint64_t>(str.data() - _input);
+        auto idx    = _push(tag::string, offset);
+        _entries.push_back(str.size());
+        return idx;
+    }
+
+    // Pushes a string that needs to be copied into the string arena.
+    std::size_t push_escaped_string(std::string_view str)
+    {
+        auto idx = _push(tag::escaped_string, _strings.size());
+        _entries.push_back(str.size());
+        _strings.append(str);
+        return idx;
+    }
+
+    // Pushes the begin entry of a container, its payload is set by `end_container()`.
+    std::size_t begin_container(tag t)
+    {
+        return _push(t, 0);
+    }
+
+    std::size_t end_container(std::size_t begin, std::size_t count)
+    {
+        auto end_tag = tag_at(begin) == tag::array_begin ? tag::array_end : tag::object_end;
+        auto end     = _push(end_tag, begin);
+
+        if (count > _max_count)
+            count = _max_count;
+        _entries[begin] |= (std::uint64_t(count) << 32) | end;
+        return begin;
+    }
+
+    //=== access ===//
+    std::size_t size() const
+    {
+        return _entries.size();
+    }
+
+    tag tag_at(std::size_t idx) const
+    {
+        return tag(_entries[idx] >> 56);
+    }
+
+    std::int64_t integer(std::size_t idx) const
+    {
+        return static_cast<std::int64_t>(_entries[idx + 1]);
+    }
+
+    double real(std::size_t idx) const
+    {
+        double result;
+        std::memcpy(&result, &_entries[idx + 1], sizeof(result));
+        return result;
+    }
+
+    std::string_view string(std::size_t idx) const
+    {
+        auto data = tag_at(idx) == tag::string ? _input : _strings.data();
+        return std::string_view(data + _payload(idx), _entries[idx + 1]);
+    }
+
+    // The index of the end entry of the container.
+    std::size_t container_end(std::size_t idx) const
+    {
+        return _payload(idx) & 0xFFFF'FFFF;
+    }
+    // The number of elements (or members) of the container, at most 2^24 - 1.
+    std::size_t container_size(std::size_t idx) const
+    {
+        return _payload(idx) >> 32;
+    }
+
+    // The index of the value after the one at `idx`.
+    std::size_t next(std::size_t idx) const
+    {
+        switch (tag_at(idx))
+        {
+        case tag::integer:
+        case tag::real:
+        case tag::string:
+        case tag::escaped_string:
+            return idx + 2;
+
+        case tag::array_begin:
+        case tag::object_begin:
+            return container_end(idx) + 1;
+
+        default:
+            return idx + 1;
+        }
+    }
+
+    void print(std::size_t idx = 0, int level = 0) const
+    {
+        switch (tag_at(idx))
+        {
+        case tag::null:
+            std::fputs("null", stdout);
+            break;
+        case tag::true_:
+            std::fputs("true", stdout);
+            break;
+        case tag::false_:
+            std::fputs("false", stdout);
+            break;
+        case tag::integer:
+            std::fprintf(stdout, "%" PRId64, integer(idx));
+            break;
+        case tag::real:
+            std::fprintf(stdout, "%.17g", real(idx));
+            break;
+
+        case tag::string:
+        case tag::escaped_string:
+            _print_string(string(idx));
+            break;
+
+        case tag::array_begin:
+        case tag::object_begin: {
+            auto is_object = tag_at(idx) == tag::object_begin;
+            std::fputs(is_object ? "{\n" : "[\n", stdout);
+
+            auto end = container_end(idx);
+            for (auto cur = idx + 1; cur != end; cur = next(cur))
+            {
+                if (cur != idx + 1)
+                    std::fputs(",\n", stdout);
+
+                _indent(level + 1);
+                if (is_object)
+                {
+                    _print_string(string(cur));
+                    std::fputs(" : ", stdout);
+                    cur = next(cur);
+                }
+                print(cur, level + 1);
+            }
+
+            std::fputs("\n", stdout);
+            _indent(level);
+            std::fputs(is_object ? "}" : "]", stdout);
+            break;
+        }
+
+        default:
+            break;
+        }
+    }
+
+private:
+    static constexpr std::size_t _max_count = (std::size_t(1) << 24) - 1;
+
+    std::size_t _push(tag t, std::uint64_t payload)
+    {
+        _entries.push_back((std::uint64_t(t) << 56) | payload);
+        return _entries.size() - 1;
+    }
+
+    std::uint64_t _payload(std::size_t idx) const
+    {
+        return _entries[idx] & ((std::uint64_t(1) << 56) - 1);
+    }
+
+    static void _indent(int level)
+    {
+        for (auto i = 0; i < level; ++i)
+            std::fputc(' ', stdout);
+    }
+
+    static void _print_string(std::string_view str)
+    {
+        std::fputc('"', stdout);
+        for (auto c : str)
+            if (c == '"')
+                std::fputs(R"(\")", stdout);
+            else if (c == '\\')
+                std::fputs(R"(\\)", stdout);
+            else if (std::iscntrl(c))
+                std::fprintf(stdout, "\\x%02x", static_cast<unsigned char>(c));
+            else
+                std::fputc(c, stdout);
+        std::fputc('"', stdout);
+    }
+
+    const char*                _input = nullptr;
+    std::vector<std::uint64_t> _entries;
+    std::string                _strings;
+};
+} // namespace tape
+
+// The grammar of JSON, the same as in `json.cpp`.
+// Instead of building values, the productions push entries onto the tape, which is passed as the
+// parse state, and return the index of the entry.
+// It lives in `tape::grammar`, so it doesn't clash with the one of `json.cpp` in the benchmark.
+namespace tape::grammar
+{
+namespace dsl = lexy::dsl;
+
+struct json_value;
+
+// A json value that is a number.
+struct number : lexy::token_production
+{
+    struct integer : lexy::transparent_production
+    {
+        static constexpr auto rule
+            = dsl::minus_sign + dsl::integer<std::int64_t>(dsl::digits<>.no_leading_zero());
+        static constexpr auto value = lexy::as_integer<std::int64_t>;
+    };
+
+    static constexpr auto rule = [] {
+        auto fraction = dsl::lit_c<'.'> >> dsl::digits<>;
+
+        auto exp_char = dsl::lit_c<'e'> / dsl::lit_c<'E'>;
+        auto exp_sign = dsl::lit_c<'-'> / dsl::lit_c<'+'>;
+        auto exponent = exp_char >> dsl::if_(exp_sign) + dsl::digits<>;
+
+        // We remember where the integer ends, so we know whether it is a real number.
+        return dsl::peek(dsl::lit_c<'-'> / dsl::digit<>)
+               >> dsl::parse_state + dsl::position + dsl::p<integer> + dsl::position
+                      + dsl::if_(fraction) + dsl::if_(exponent) + dsl::position;
+    }();
+
+    static constexpr auto value = lexy::callback<std::size_t>(
+        [](tape::json_tape& tape, auto begin, std::int64_t integer, auto integer_end, auto end) {
+            if (integer_end == end)
+                return tape.push_integer(integer);
+
+            // strtod() needs a null-terminated string.
+            char        buffer[64];
+            std::string long_number;
+            auto        size = static_cast<std::size_t>(end - begin);
+            auto        str  = buffer;
+            if (size >= sizeof(buffer))
+            {
+                long_number.resize(size);
+                str = long_number.data();
+            }
+            std::memcpy(str, begin, size);
+            str[size] = '\0';
+
+            return tape.push_real(std::strtod(str, nullptr));
+        });
+};
+
+// The content of a string literal.
+// As long as there are no escape sequences, it is just a range of the input.
+struct string_content
+{
+    std::string_view raw;
+    bool             escaped = false;
+    std::string      unescaped;
+};
+
+// A sink that collects the characters of a string literal into a `string_content`.
+struct string_sink
+{
+    struct _sink
+    {
+        string_content _result;
+
+        using return_type = string_content;
+
+        template <typename Reader>
+        void operator()(lexy::lexeme<Reader> lex)
+        {
+            auto str = reinterpret_cast<const char*>(lex.data());
+            if (_result.escaped)
+                _result.unescaped.append(str, lex.size());
+            else if (_result.raw.data() == nullptr)
+                _result.raw = std::string_view(str, lex.size());
+            else
+                // The lexemes are adjacent until we see an escape sequence.
+                _result.raw = std::string_view(_result.raw.data(), _result.raw.size() + lex.size());
+        }
+
+        void operator()(char c)
+        {
+            _begin_escape();
+            _result.unescaped.push_back(c);
+        }
+        void operator()(lexy::code_point cp)
+        {
+            _begin_escape();
+
+            LEXY_CHAR8_T buffer[4] = {};
+            auto         size      = lexy::utf8_encoding::encode_code_point(cp, buffer, 4);
+            _result.unescaped.append(reinterpret_cast<const char*>(buffer), size);
+        }
+
+        string_content&& finish() &&
+        {
+            return LEXY_MOV(_result);
+        }
+
+        void _begin_escape()
+        {
+            if (!_result.escaped)
+            {
+                _result.escaped = true;
+                _result.unescaped.assign(_result.raw);
+            }
+        }
+    };
+
+    constexpr auto sink() const
+    {
+        return _sink{};
+    }
+};
+
+// A json value that is a string.
+struct string : lexy::token_production
+{
+    struct invalid_char
+    {
+        static LEXY_CONSTEVAL auto name()
+        {
+            return "invalid character in string literal";
+        }
+    };
+
+    // A mapping of the simple escape sequences to their replacement values.
+    static constexpr auto escaped_symbols = lexy::symbol_table<char> //
+                                                .map<'"'>('"')
+                                                .map<'\\'>('\\')
+                                                .map<'/'>('/')
+                                                .map<'b'>('\b')
+                                                .map<'f'>('\f')
+                                                .map<'n'>('\n')
+                                                .map<'r'>('\r')
+                                                .map<'t'>('\t');
+
+    static constexpr auto rule = [] {
+        // Everything is allowed inside a string except for control characters.
+        auto code_point = (dsl::code_point - dsl::ascii::control).error<invalid_char>;
+
+        // Escape sequences start with a backlash and either map one of the symbols,
+        // or a Unicode code point of the form uXXXX.
+        auto escape = dsl::backslash_escape //
+                          .symbol<escaped_symbols>()
+                          .rule(dsl::lit_c<'u'> >> dsl::code_point_id<4>);
+
+        // String of code_point with specified escape sequences, surrounded by ".
+        // We abort string parsing if we see a newline to handle missing closing ".
+        // The parse state isn't a branch, so we need to peek for the opening quote first.
+        return dsl::peek(dsl::lit_c<'"'>)
+               >> dsl::parse_state + dsl::quoted.limit(dsl::ascii::newline)(code_point, escape);
+    }();
+
+    static constexpr auto value
+        = string_sink{}
+          >> lexy::callback<std::size_t>([](tape::json_tape& tape, string_content&& content) {
+                 if (content.escaped)
+                     return tape.push_escaped_string(content.unescaped);
+                 else
+                     return tape.push_string(content.raw);
+             });
+};
+
+// Pushes the begin entry of a container onto the tape, before any of its elements.
+template <tape::tag Tag>
+struct container_begin
+{
+    static constexpr auto rule = dsl::parse_state;
+    static constexpr auto value = lexy::callback<std::size_t>(
+        [](tape::json_tape& tape) { return tape.begin_container(Tag); });
+};
+
+// The elements of a container have already been pushed, we only need to count them.
+constexpr auto container_end
+    = lexy::collect(lexy::noop)
+      >> lexy::callback<std::size_t>(
+          [](tape::json_tape& tape, std::size_t begin, std::size_t count) {
+              return tape.end_container(begin, count);
+          });
+
+struct unexpected_trailing_comma
+{
+    static constexpr auto name = "unexpected trailing comma";
+};
+
+// A json value that is an array.
+struct array
+{
+    // A (potentially empty) list of json values, seperated by comma and surrounded by square
+    // brackets.
+    static constexpr auto rule
+        = dsl::square_bracketed.open()
+          >> dsl::parse_state + dsl::p<container_begin<tape::tag::array_begin>>
+                 + dsl::square_bracketed.as_terminator().opt_list(
+                     dsl::recurse<json_value>,
+                     // Trailing seperators are not allowed.
+                     // Use `dsl::trailing_sep()` if you want to allow it.
+                     dsl::sep(dsl::comma).trailing_error<unexpected_trailing_comma>);
+
+    static constexpr auto value = container_end;
+};
+
+// A json value that is an object.
+struct object
+{
+    static constexpr auto rule = [] {
+        // We try parsing the colon. This means that a missing colon raises an error, which is then
+        // caught and parsing continues as if nothing happens. Without the try, parsing the current
+        // item would be canceled immediately.
+        auto item = dsl::p<string> + dsl::try_(dsl::colon) + dsl::recurse<json_value>;
+
+        // Trailing seperators are not allowed.
+        // Use `dsl::trailing_sep()` if you want to allow it.
+        auto sep = dsl::sep(dsl::comma).trailing_error<unexpected_trailing_comma>;
+
+        // A (potentially empty) list of items, seperated by comma and surrounded by curly brackets.
+        return dsl::curly_bracketed.open()
+               >> dsl::parse_state + dsl::p<container_begin<tape::tag::object_begin>>
+                      + dsl::curly_bracketed.as_terminator().opt_list(item, sep);
+    }();
+
+    static constexpr auto value = container_end;
+};
+
+// A json value.
+struct json_value : lexy::transparent_production
+{
+    static constexpr auto name = "json value";
+
+    struct expected_json_value
+    {
+        static LEXY_CONSTEVAL auto name()
+        {
+            return "expected json value";
+        }
+    };
+
+    static constexpr auto rule = [] {
+        auto null   = LEXY_LIT("null") >> dsl::value_c<tape::tag::null>;
+        auto true_  = LEXY_LIT("true") >> dsl::value_c<tape::tag::true_>;
+        auto false_ = LEXY_LIT("false") >> dsl::value_c<tape::tag::false_>;
+
+        auto primitive = null | true_ | false_ | dsl::p<number> | dsl::p<string>;
+        auto complex   = dsl::p<object> | dsl::p<array>;
+
+        return dsl::parse_state + (primitive | complex | dsl::error<expected_json_value>);
+    }();
+
+    // Only the literals haven't pushed themselves yet.
+    static constexpr auto value = lexy::callback<std::size_t>(
+        [](tape::json_tape&, std::size_t idx) { return idx; },
+        [](tape::json_tape& tape, tape::tag t) { return tape.push_literal(t); });
+};
+
+// Entry point of the production.
+struct json
+{
+    // Whitespace is a sequence of space, tab, carriage return, or newline.
+    // Add your comment syntax here.
+    static constexpr auto whitespace = dsl::ascii::space / dsl::ascii::newline;
+
+    static constexpr auto rule  = dsl::whitespace + dsl::p<json_value> + dsl::eof;
+    static constexpr auto value = lexy::noop;
+};
+} // namespace tape::grammar
+
+// Parses the input into the tape, the input must outlive it.
+template <typename Input, typename Callback>
+auto parse_json(tape::json_tape& tape, const Input& input, Callback callback)
+{
+    tape.reset(input);
+    return lexy::parse<tape::grammar::json>(input, tape, callback);
+}
+
+#ifndef LEXY_TEST
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "usage: %s <filename>", argv[0]);
+        return 1;
+    }
+
+    // We're requiring UTF-8 input.
+    auto file = lexy::read_file<lexy::utf8_encoding>(argv[1]);
+    if (!file)
+    {
+        std::fprintf(stderr, "file '%s' not found", argv[1]);
+        return 1;
+    }
+
+    tape::json_tape tape;
+    auto            result = parse_json(tape, file, lexy_ext::report_error);
+    if (result.has_value())
+        tape.print();
+
+    if (!result)
+        return 2;
+}
+#endif
+
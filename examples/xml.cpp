@@ -3,6 +3,7 @@
 // found in the top-level directory of this distribution.
 
 #include <cstdio>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <vector>
@@ -159,6 +160,14 @@ constexpr auto name = [] {
     return dsl::identifier(head_char.error<invalid_character>, trailing_char);
 }();
 
+// The name in the opening tag of an element.
+// It is a separate production, so it is reported by `lexy::parse_events()`.
+struct tag_name
+{
+    static constexpr auto rule  = name;
+    static constexpr auto value = lexy::as_string<std::string>;
+};
+
 // A pre-defined entity reference.
 struct reference
 {
@@ -226,7 +235,7 @@ struct element
         // It also checks for an empty tag (<name/>), in which case we're done and immediately
         // return.
         auto empty    = dsl::if_(LEXY_LIT("/") >> LEXY_LIT(">") + dsl::return_);
-        auto open_tag = open_tagged(name_var.capture(name) + ws + empty);
+        auto open_tag = open_tagged(name_var.capture(dsl::p<tag_name>) + ws + empty);
 
         // The closing tag matches the name again and requires that it matches the one we've stored
         // earlier.
@@ -245,12 +254,11 @@ struct element
     // We collect the children as vector; then we construct a node from it.
     static constexpr auto value
         = lexy::as_list<std::vector<ast::xml_node_ptr>> >> lexy::callback<ast::xml_node_ptr>(
-              [](auto name) {
-                  return std::make_unique<ast::xml_element>(lexy::as_string<std::string>(name));
+              [](std::string&& name) {
+                  return std::make_unique<ast::xml_element>(LEXY_MOV(name));
               },
-              [](auto name, auto&& children) {
-                  return std::make_unique<ast::xml_element>(lexy::as_string<std::string>(name),
-                                                            LEXY_MOV(children));
+              [](std::string&& name, auto&& children) {
+                  return std::make_unique<ast::xml_element>(LEXY_MOV(name), LEXY_MOV(children));
               });
 };
 
@@ -266,6 +274,53 @@ struct document
 };
 } // namespace grammar
 
+// Reports the XML document as events instead of building the AST, see `lexy::parse_events()`.
+// Only the nesting of the document is kept in memory.
+namespace events
+{
+// The Handler has the member functions `start_element(name)`, `end_element()`, `text(lexeme)`,
+// `reference(lexeme)`, and `cdata(lexeme)`.
+// All lexemes point into the input: references are unresolved and CDATA is without delimiters.
+template <typename Handler>
+class xml_visitor
+{
+public:
+    explicit xml_visitor(Handler& handler) : _handler(&handler) {}
+
+    // We start the element once we know its name.
+    template <typename Lexeme>
+    void finish(grammar::tag_name, Lexeme name)
+    {
+        _handler->start_element(name);
+    }
+    template <typename Lexeme>
+    void finish(grammar::element, Lexeme)
+    {
+        _handler->end_element();
+    }
+
+    template <typename Lexeme>
+    void finish(grammar::text, Lexeme lexeme)
+    {
+        _handler->text(lexeme);
+    }
+    template <typename Lexeme>
+    void finish(grammar::reference, Lexeme lexeme)
+    {
+        _handler->reference(lexeme);
+    }
+    template <typename Lexeme>
+    void finish(grammar::cdata, Lexeme lexeme)
+    {
+        // Remove `<![CDATA[` and `]]>`.
+        _handler->cdata(Lexeme(std::next(lexeme.begin(), 9), std::prev(lexeme.end(), 3)));
+    }
+
+private:
+    Handler* _handler;
+};
+} // namespace events
+
 #ifndef LEXY_TEST
 int main(int argc, char** argv)
 {
@@ -0,0 +1,149 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_FUZZ_COST_HPP_INCLUDED
+#define LEXY_FUZZ_COST_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+#include <lexy/input/instrumented_input.hpp>
+#include <lexy/input/string_input.hpp>
+#include <lexy/validate.hpp>
+
+#ifndef LEXY_FUZZ_REGRESSION_DIR
+#    define LEXY_FUZZ_REGRESSION_DIR "regressions"
+#endif
+
+namespace lexy_fuzz
+{
+/// Validates the input and returns the number of reader operations it took.
+/// Copies of the reader share the statistics, so backtracking and rescans are counted as well.
+template <typename Production, typename Encoding>
+std::size_t measure(const std::uint8_t* data, std::size_t size)
+{
+    auto string = lexy::string_input<Encoding>(reinterpret_cast<const char*>(data), size);
+    auto input  = lexy::instrumented_input(string);
+    lexy::validate<Production>(input, lexy::noop);
+    return input.statistics().peeks() + input.statistics().bumps();
+}
+
+/// The options of `check_cost()`, they can be overridden by environment variables.
+struct cost_options
+{
+    /// Inputs smaller than that aren't checked; overhead dominates the cost there.
+    /// `LEXY_FUZZ_MIN_SIZE`
+    std::size_t min_size = 64;
+    /// The operations per byte an input needs to exceed to be flagged.
+    /// `LEXY_FUZZ_OPS_PER_BYTE`
+    double ops_per_byte = 64;
+    /// The factor by which the operations per byte need to grow when doubling the input.
+    /// `LEXY_FUZZ_GROWTH`
+    double growth = 1.5;
+    /// The directory where flagged inputs are saved.
+    /// `LEXY_FUZZ_REGRESSIONS`
+    std::string regression_dir = LEXY_FUZZ_REGRESSION_DIR;
+
+    static cost_options from_env()
+    {
+        cost_options result;
+        if (auto min_size = std::getenv("LEXY_FUZZ_MIN_SIZE"))
+            result.min_size = std::strtoull(min_size, nullptr, 10);
+        if (auto ops_per_byte = std::getenv("LEXY_FUZZ_OPS_PER_BYTE"))
+            result.ops_per_byte = std::strtod(ops_per_byte, nullptr);
+        if (auto growth = std::getenv("LEXY_FUZZ_GROWTH"))
+            result.growth = std::strtod(growth, nullptr);
+        if (auto dir = std::getenv("LEXY_FUZZ_REGRESSIONS"))
+            result.regression_dir = dir;
+        return result;
+    }
+};
+
+/// The result of `check_cost()`.
+struct cost_report
+{
+    std::size_t size;
+    double      ops_per_byte;
+    double      half_ops_per_byte;
+    bool        super_linear;
+};
+
+// FNV-1a, to give saved inputs a stable name.
+inline std::uint64_t _hash(const std::uint8_t* data, std::size_t size)
+{
+    auto result = std::uint64_t(14695981039346656037ull);
+    for (auto i = std::size_t(0); i != size; ++i)
+        result = (result ^ data[i]) * std::uint64_t(1099511628211ull);
+    return result;
+}
+
+inline void save_regression(const char* grammar, const cost_options& options,
+                            const std::uint8_t* data, std::size_t size)
+{
+    auto dir = std::filesystem::path(options.regression_dir) / grammar;
+    std::filesystem::create_directories(dir);
+
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.input",
+                  static_cast<unsigned long long>(_hash(data, size)));
+
+    auto path = (dir / name).string();
+    auto file = std::fopen(path.c_str(), "wb");
+    if (!file)
+    {
+        std::fprintf(stderr, "lexy_fuzz: unable to save super-linear input as '%s'\n",
+                     path.c_str());
+        return;
+    }
+    std::fwrite(data, 1, size, file);
+    std::fclose(file);
+
+    std::fprintf(stderr, "lexy_fuzz: saved super-linear input as '%s'\n", path.c_str());
+}
+
+/// Measures the reader operations per byte of the input and of its first half.
+/// An input is super-linear if it needs a lot of operations per byte,
+/// and they keep growing with the size of the input.
+template <typename Production, typename Encoding>
+cost_report check_cost(const std::uint8_t* data, std::size_t size, const cost_options& options)
+{
+    cost_report report{size, 0, 0, false};
+    if (size < options.min_size)
+        return report;
+
+    auto per_byte = [](std::size_t ops, std::size_t size) { return double(ops) / double(size); };
+    report.ops_per_byte = per_byte(measure<Production, Encoding>(data, size), size);
+    if (report.ops_per_byte <= options.ops_per_byte)
+        return report;
+
+    // The first half of the input should take roughly the same number of operations per byte
+    // for a linear parse; a quadratic one needs half as many.
+    report.half_ops_per_byte = per_byte(measure<Production, Encoding>(data, size / 2), size / 2);
+    report.super_linear      = report.ops_per_byte > options.growth * report.half_ops_per_byte;
+    return report;
+}
+} // namespace lexy_fuzz
+
+/// Defines the libFuzzer entry point for the production.
+/// Super-linear inputs are saved to the regression directory and abort the fuzzer.
+#define LEXY_FUZZ_TARGET(Grammar, Production, Encoding)                                            \
+    extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size)              \
+    {                                                                                              \
+        static const auto options = lexy_fuzz::cost_options::from_env();                           \
+        auto report = lexy_fuzz::check_cost<Production, Encoding>(data, size, options);            \
+        if (report.super_linear)                                                                   \
+        {                                                                                          \
+            std::fprintf(stderr, "lexy_fuzz: %zu bytes take %.1f ops/byte, first half %.1f\n",     \
+                         report.size, report.ops_per_byte, report.half_ops_per_byte);              \
+            lexy_fuzz::save_regression(Grammar, options, data, size);                              \
+            std::abort();                                                                          \
+        }                                                                                          \
+        return 0;                                                                                  \
+    }
+
+#endif // LEXY_FUZZ_COST_HPP_INCLUDED
@@ -0,0 +1,48 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+// Replays inputs through the fuzz target, for compilers without libFuzzer.
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size);
+
+namespace
+{
+void run(const std::filesystem::path& path)
+{
+    std::ifstream             file(path, std::ios::binary);
+    std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(file)),
+                                   std::istreambuf_iterator<char>());
+
+    std::fprintf(stderr, "%s\n", path.string().c_str());
+    LLVMFuzzerTestOneInput(data.data(), data.size());
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "usage: %s <file or directory>...\n", argv[0]);
+        return 1;
+    }
+
+    for (auto i = 1; i != argc; ++i)
+    {
+        if (std::filesystem::is_directory(argv[i]))
+        {
+            for (auto& entry : std::filesystem::recursive_directory_iterator(argv[i]))
+                if (entry.is_regular_file())
+                    run(entry.path());
+        }
+        else
+            run(argv[i]);
+    }
+}
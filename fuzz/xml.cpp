@@ -0,0 +1,10 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include "cost.hpp"
+
+#define LEXY_TEST
+#include "../examples/xml.cpp"
+
+LEXY_FUZZ_TARGET("xml", grammar::document, lexy::utf8_encoding)
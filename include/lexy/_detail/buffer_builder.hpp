@@ -29,7 +29,10 @@ class buffer_builder
 public:
     buffer_builder() noexcept : _data(_stack_buffer), _read_size(0), _write_size(stack_buffer_size)
     {
-        static_assert(sizeof(*this) == total_size_bytes, "invalid buffer size calculation");
+        // It can be smaller if the size of T doesn't divide the remaining bytes.
+        static_assert(sizeof(*this) <= total_size_bytes
+                          && total_size_bytes - sizeof(*this) < sizeof(T) + alignof(T),
+                      "invalid buffer size calculation");
     }
 
     ~buffer_builder() noexcept
@@ -75,6 +78,14 @@ public:
         _read_size = 0;
     }
 
+    // Removes all but the first n characters of the read area, they become part of the write area.
+    void truncate(std::size_t n) noexcept
+    {
+        LEXY_PRECONDITION(n <= _read_size);
+        _write_size += _read_size - n;
+        _read_size = n;
+    }
+
     // Takes the first n characters of the write area and appends them to the read area.
     void commit(std::size_t n) noexcept
     {
@@ -83,6 +94,16 @@ public:
         _write_size -= n;
     }
 
+    // Removes the first n characters of the read area, moving the remaining ones to the front.
+    // This increases the write area and invalidates all pointers.
+    void discard(std::size_t n) noexcept
+    {
+        LEXY_PRECONDITION(n <= _read_size);
+        std::memmove(_data, _data + n, (_read_size - n) * sizeof(T));
+        _read_size -= n;
+        _write_size += n;
+    }
+
     // Increases the write area, invalidates all pointers.
     void grow()
     {
@@ -92,7 +113,7 @@ public:
         // Allocate new memory.
         auto memory = static_cast<T*>(::operator new(new_cap * sizeof(T)));
         // Copy the read area into the new memory.
-        std::memcpy(memory, _data, _read_size);
+        std::memcpy(memory, _data, _read_size * sizeof(T));
 
         // Release the old memory, if there was any.
         if (_data != _stack_buffer)
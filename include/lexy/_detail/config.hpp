@@ -144,6 +144,36 @@ struct _char8_str
 #    endif
 #endif
 
+//=== noinline ===//
+#ifndef LEXY_NOINLINE
+#    if defined(__has_cpp_attribute)
+#        if __has_cpp_attribute(gnu::noinline)
+#            define LEXY_NOINLINE [[gnu::noinline]]
+#        endif
+#    endif
+#
+#    ifndef LEXY_NOINLINE
+#        if defined(_MSC_VER)
+#            define LEXY_NOINLINE __declspec(noinline)
+#        else
+#            define LEXY_NOINLINE
+#        endif
+#    endif
+#endif
+
+//=== inline policy ===//
+// Rules are force inlined and production boundaries are left to the compiler.
+#define LEXY_INLINE_POLICY_DEFAULT 0
+// Rules are force inlined into their production, but productions are never inlined.
+// This trades some throughput for considerably smaller code on big grammars.
+#define LEXY_INLINE_POLICY_PRODUCTION 1
+// Nothing is force inlined, the compiler decides everything.
+#define LEXY_INLINE_POLICY_COMPILER 2
+
+#ifndef LEXY_INLINE_POLICY
+#    define LEXY_INLINE_POLICY LEXY_INLINE_POLICY_DEFAULT
+#endif
+
 //=== empty_member ===//
 #ifndef LEXY_EMPTY_MEMBER
 
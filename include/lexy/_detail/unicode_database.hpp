@@ -0,0 +1,1051 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+// This file is generated by support/generate-unicode-database.py, do not edit.
+// Unicode version 14.0.0.
+
+#ifndef LEXY_DETAIL_UNICODE_DATABASE_HPP_INCLUDED
+#define LEXY_DETAIL_UNICODE_DATABASE_HPP_INCLUDED
+
+#include <cstdint>
+#include <lexy/_detail/config.hpp>
+
+namespace lexy
+{
+/// The general category of a code point.
+enum class unicode_category : std::uint_least8_t
+{
+    Cn, // unassigned
+    Lu, // uppercase letter
+    Ll, // lowercase letter
+    Lt, // titlecase letter
+    Lm, // modifier letter
+    Lo, // other letter
+    Mn, // nonspacing mark
+    Mc, // spacing mark
+    Me, // enclosing mark
+    Nd, // decimal number
+    Nl, // letter number
+    No, // other number
+    Pc, // connector punctuation
+    Pd, // dash punctuation
+    Ps, // open punctuation
+    Pe, // close punctuation
+    Pi, // initial punctuation
+    Pf, // final punctuation
+    Po, // other punctuation
+    Sm, // math symbol
+    Sc, // currency symbol
+    Sk, // modifier symbol
+    So, // other symbol
+    Zs, // space separator
+    Zl, // line separator
+    Zp, // paragraph separator
+    Cc, // control
+    Cf, // format
+    Cs, // surrogate
+    Co, // private use
+};
+} // namespace lexy
+
+namespace lexy::_detail
+{
+// The bits in the byte of each code point.
+enum unicode_database_bits : std::uint_least8_t
+{
+    unicode_database_category     = 0x1f,
+    unicode_database_xid_start    = 0x20,
+    unicode_database_xid_continue = 0x40,
+    unicode_database_white_space  = 0x80,
+};
+
+inline constexpr std::uint_least8_t unicode_database_stage1[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 28, 26, 29, 30, 31, 32, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 33, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 26, 56,
+    57, 58, 58, 58, 58, 59, 26, 26, 60, 58, 58, 58, 58, 58, 58, 58, 26, 61, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 26, 62, 58, 63, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 64, 26, 26, 65, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 66, 67, 68,
+    58, 58, 58, 58, 69, 58, 58, 58, 58, 58, 58, 58, 58, 70, 71, 72, 73, 74, 75, 76, 58, 77, 78, 79,
+    58, 80, 81, 58, 82, 83, 84, 85, 75, 86, 87, 88, 58, 58, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 89, 26, 26, 26, 26, 26, 26, 26, 90, 91, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 92, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 93, 58, 58, 58, 58, 58, 58, 26, 94, 58, 58, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 95, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 96, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 97, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 97,
+};
+
+inline constexpr std::uint_least16_t unicode_database_stage2[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 8, 16, 17, 18, 19, 20, 21, 22, 23, 23, 23,
+    24, 25, 26, 27, 28, 29, 30, 18, 8, 31, 8, 32, 8, 8, 33, 34, 18, 35, 36, 37, 38, 39, 40, 41, 42,
+    40, 40, 43, 44, 45, 46, 47, 40, 40, 48, 49, 50, 51, 52, 53, 54, 55, 40, 56, 57, 58, 59, 60, 61,
+    62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 101, 105, 106,
+    107, 108, 109, 110, 111, 101, 40, 112, 113, 114, 115, 29, 116, 117, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 118, 40, 119, 120, 121, 40, 122, 40, 123, 124, 125, 29, 29, 126, 127, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 128, 129, 40, 40, 130, 131, 132,
+    133, 134, 40, 135, 136, 137, 138, 40, 139, 140, 141, 142, 40, 143, 144, 145, 146, 147, 40, 148,
+    149, 150, 151, 40, 152, 153, 154, 155, 156, 101, 157, 158, 159, 160, 161, 162, 40, 163, 40, 164,
+    165, 166, 167, 168, 169, 170, 18, 171, 172, 173, 174, 172, 23, 23, 8, 8, 8, 8, 175, 8, 8, 8,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194,
+    195, 196, 197, 198, 199, 200, 200, 200, 200, 200, 200, 200, 200, 201, 202, 150, 203, 204, 205,
+    206, 207, 150, 208, 209, 210, 211, 150, 150, 212, 150, 150, 150, 150, 150, 213, 214, 215, 150,
+    150, 150, 216, 150, 150, 150, 150, 150, 150, 150, 217, 218, 150, 219, 220, 150, 150, 150, 150,
+    150, 150, 150, 150, 200, 200, 200, 200, 221, 200, 222, 223, 200, 200, 200, 200, 200, 200, 200,
+    200, 150, 224, 225, 226, 227, 150, 150, 150, 29, 30, 18, 228, 8, 8, 8, 229, 18, 230, 40, 231,
+    232, 233, 233, 23, 234, 235, 236, 101, 237, 150, 150, 238, 150, 150, 150, 150, 150, 150, 239,
+    240, 241, 242, 98, 40, 243, 127, 40, 244, 245, 246, 40, 40, 247, 40, 150, 248, 249, 250, 251,
+    150, 250, 252, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 150,
+    150, 253, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 254, 150,
+    255, 166, 40, 40, 40, 40, 40, 40, 40, 40, 256, 257, 8, 258, 259, 40, 40, 260, 261, 262, 8, 263,
+    264, 265, 266, 267, 268, 269, 40, 270, 271, 272, 273, 274, 49, 275, 276, 277, 58, 278, 279, 280,
+    40, 281, 282, 283, 40, 284, 285, 286, 287, 288, 289, 290, 18, 18, 40, 291, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 292, 293, 294, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295,
+    295, 295, 295, 295, 295, 295, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296,
+    296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 297, 40, 40, 298, 101, 299, 300, 301, 40, 40, 302, 303, 40, 40, 40, 304, 305, 40, 40, 40,
+    40, 40, 306, 307, 40, 308, 40, 309, 310, 311, 312, 313, 314, 40, 40, 40, 315, 316, 2, 317, 318,
+    319, 144, 320, 321, 322, 323, 324, 101, 40, 40, 40, 325, 326, 327, 195, 328, 329, 330, 331, 332,
+    101, 101, 101, 101, 277, 40, 333, 334, 40, 335, 336, 337, 338, 40, 339, 101, 29, 340, 341, 40,
+    342, 343, 344, 345, 40, 346, 40, 347, 348, 349, 101, 101, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    232, 143, 350, 351, 352, 101, 101, 353, 354, 355, 356, 144, 357, 101, 358, 359, 360, 101, 101,
+    40, 361, 362, 210, 363, 364, 365, 366, 367, 101, 368, 369, 40, 370, 371, 372, 373, 374, 101,
+    101, 40, 40, 375, 101, 29, 376, 18, 377, 40, 378, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    379, 40, 380, 101, 101, 367, 381, 382, 383, 384, 383, 385, 232, 386, 387, 388, 389, 161, 390,
+    391, 392, 393, 394, 395, 396, 161, 397, 398, 399, 400, 401, 101, 101, 402, 403, 404, 405, 406,
+    407, 408, 409, 101, 101, 101, 101, 40, 410, 411, 412, 40, 413, 414, 101, 101, 101, 101, 101, 40,
+    415, 416, 101, 40, 417, 418, 419, 40, 420, 421, 101, 123, 422, 423, 101, 101, 101, 101, 101, 40,
+    424, 101, 101, 101, 29, 18, 425, 426, 427, 428, 101, 101, 429, 430, 431, 432, 433, 434, 40, 435,
+    436, 40, 140, 101, 101, 101, 101, 101, 101, 101, 101, 437, 438, 439, 440, 441, 442, 101, 101,
+    443, 444, 445, 446, 447, 421, 101, 101, 101, 101, 101, 101, 101, 101, 101, 448, 101, 101, 101,
+    101, 101, 449, 450, 451, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 298, 101, 101, 101,
+    195, 195, 195, 452, 40, 40, 40, 40, 40, 40, 453, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 383, 40, 40, 454, 40, 455, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 40, 40, 423, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 40, 140, 144, 456, 40, 144, 457, 458, 40, 459, 460, 461, 462, 101, 101, 101, 101, 101,
+    29, 18, 463, 101, 101, 101, 40, 40, 464, 465, 466, 101, 101, 467, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 468, 40, 40, 40, 40, 40, 40, 143, 101, 375, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 469,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 470, 471, 472, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    294, 101, 101, 101, 101, 101, 101, 101, 101, 40, 40, 40, 473, 474, 475, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 23, 476, 477, 150, 150, 150,
+    478, 101, 150, 150, 150, 150, 150, 150, 150, 239, 150, 479, 150, 480, 481, 482, 150, 209, 150,
+    150, 483, 101, 101, 101, 101, 484, 150, 150, 485, 486, 101, 101, 101, 101, 487, 488, 489, 490,
+    491, 492, 493, 494, 495, 496, 497, 498, 499, 487, 488, 500, 490, 501, 502, 503, 494, 504, 505,
+    506, 507, 508, 509, 510, 511, 512, 513, 514, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+    150, 150, 150, 150, 150, 150, 23, 515, 23, 516, 517, 518, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 519, 101, 101, 101, 101, 101, 101, 101,
+    520, 521, 101, 101, 101, 101, 101, 101, 40, 522, 523, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 383, 524, 40, 525, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 526, 40, 40, 40, 40, 40, 40, 527, 101, 29, 528,
+    529, 101, 101, 101, 101, 101, 101, 101, 101, 530, 210, 531, 101, 101, 532, 533, 101, 101, 101,
+    101, 101, 101, 534, 535, 536, 537, 538, 539, 101, 540, 101, 101, 101, 101, 101, 101, 101, 101,
+    150, 541, 150, 150, 238, 542, 543, 239, 544, 150, 150, 150, 150, 545, 101, 546, 547, 548, 549,
+    550, 101, 101, 101, 101, 150, 150, 150, 150, 150, 150, 150, 551, 150, 150, 150, 150, 150, 150,
+    552, 553, 150, 150, 150, 238, 150, 150, 554, 555, 541, 150, 556, 150, 557, 558, 101, 101, 150,
+    150, 150, 150, 150, 150, 150, 150, 150, 150, 238, 559, 560, 561, 562, 563, 150, 150, 150, 150,
+    564, 150, 209, 565, 40, 40, 40, 40, 40, 40, 40, 101, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 140, 40, 40, 40, 40, 40, 40, 342, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 566, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 567, 342, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 568, 101, 101,
+    101, 101, 101, 569, 570, 570, 570, 101, 101, 101, 101, 23, 23, 23, 23, 23, 23, 23, 571, 296,
+    296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 572,
+};
+
+inline constexpr std::uint_least8_t unicode_database_stage3[] = {
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 154, 154, 154, 154, 154, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 151, 18, 18, 18, 20, 18, 18, 18, 14, 15, 18, 19, 18, 13, 18,
+    18, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 18, 18, 19, 19, 19, 18, 18, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 14, 18, 15, 21,
+    76, 21, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 14, 19, 15, 19, 26, 26, 26, 26, 26, 26, 154, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 151, 18, 20, 20, 20, 20, 22,
+    18, 21, 22, 101, 16, 19, 27, 22, 21, 22, 19, 11, 11, 21, 98, 18, 82, 21, 11, 101, 17, 11, 11,
+    11, 18, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 19, 97, 97, 97, 97, 97, 97, 97, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 19, 98, 98, 98, 98, 98, 98, 98, 98, 97, 98, 97, 98, 97, 98,
+    97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98,
+    97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98,
+    97, 98, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 98, 97, 98, 97, 98,
+    97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98,
+    97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 97, 98, 97, 98, 97,
+    98, 98, 98, 97, 97, 98, 97, 98, 97, 97, 98, 97, 97, 97, 98, 98, 97, 97, 97, 97, 98, 97, 97, 98,
+    97, 97, 97, 98, 98, 98, 97, 97, 98, 97, 97, 98, 97, 98, 97, 98, 97, 97, 98, 97, 98, 98, 97, 98,
+    97, 97, 98, 97, 97, 97, 98, 97, 98, 97, 97, 98, 98, 101, 97, 98, 98, 98, 101, 101, 101, 101, 97,
+    99, 98, 97, 99, 98, 97, 99, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98,
+    98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 98, 97, 99, 98, 97,
+    98, 97, 97, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97,
+    98, 97, 98, 97, 98, 97, 98, 98, 98, 98, 98, 98, 98, 97, 97, 98, 97, 97, 98, 98, 97, 98, 97, 97,
+    97, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 101, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 100, 100, 21, 21, 21, 21, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 100, 100, 100, 100,
+    100, 21, 21, 21, 21, 21, 21, 21, 100, 21, 100, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 97, 98, 97, 98, 100, 21, 97, 98, 0, 0, 4, 98, 98, 98, 18, 97, 0, 0, 0, 0,
+    21, 21, 97, 82, 97, 97, 97, 0, 97, 0, 97, 97, 98, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 0, 97, 97, 97, 97, 97, 97, 97, 97, 97, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 97, 98, 98, 97, 97, 97, 98, 98, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98,
+    97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 98, 98, 98, 98, 97, 98, 19, 97, 98, 97, 97, 98,
+    98, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 97, 98, 22, 70,
+    70, 70, 70, 70, 8, 8, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98,
+    97, 98, 97, 98, 97, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 98, 97, 98, 97, 98,
+    97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98,
+    97, 98, 97, 98, 0, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 0, 0, 100, 18, 18,
+    18, 18, 18, 18, 98, 98, 98, 98, 98, 98, 98, 98, 98, 18, 13, 0, 0, 22, 22, 20, 0, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 13, 70, 18, 70, 70, 18, 70,
+    70, 18, 70, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 101, 101,
+    101, 101, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 27, 27, 27, 27, 27, 19, 19, 19, 18, 18,
+    20, 18, 18, 22, 22, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 18, 27, 18, 18, 18, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 100, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 18, 18, 18, 18, 101, 101, 70, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 18, 101, 70, 70, 70, 70, 70, 70, 70,
+    27, 22, 70, 70, 70, 70, 70, 70, 100, 100, 70, 70, 22, 70, 70, 70, 70, 101, 101, 73, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 101, 101, 101, 22, 22, 101, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 0, 27, 101, 70, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 101, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 70, 70, 70, 70, 70, 70, 70, 70, 100, 100, 22,
+    18, 18, 18, 100, 0, 0, 70, 20, 20, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 70, 70, 70, 100, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 100, 70, 70, 70, 100, 70, 70, 70, 70, 70, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 70, 70, 0, 0, 18, 0, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 21, 101, 101,
+    101, 101, 101, 101, 0, 27, 27, 0, 0, 0, 0, 0, 0, 70, 70, 70, 70, 70, 70, 70, 70, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 100, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 27, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 71, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 71, 70, 101, 71, 71, 71, 70, 70,
+    70, 70, 70, 70, 70, 70, 71, 71, 71, 71, 70, 71, 71, 101, 70, 70, 70, 70, 70, 70, 70, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 70, 70, 18, 18, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    18, 100, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 71, 71,
+    0, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 101, 101, 0, 0, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101,
+    101, 101, 101, 101, 101, 0, 101, 0, 0, 0, 101, 101, 101, 101, 0, 0, 70, 101, 71, 71, 71, 70, 70,
+    70, 70, 0, 0, 71, 71, 0, 0, 71, 71, 70, 101, 0, 0, 0, 0, 0, 0, 0, 0, 71, 0, 0, 0, 0, 101, 101,
+    0, 101, 101, 101, 70, 70, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 101, 101, 20, 20, 11,
+    11, 11, 11, 11, 11, 22, 20, 101, 18, 70, 0, 0, 70, 70, 71, 0, 101, 101, 101, 101, 101, 101, 0,
+    0, 0, 0, 101, 101, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 0,
+    101, 101, 0, 101, 101, 0, 0, 70, 0, 71, 71, 71, 70, 70, 0, 0, 0, 0, 70, 70, 0, 0, 70, 70, 70, 0,
+    0, 0, 70, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 0, 101, 0, 0, 0, 0, 0, 0, 0, 73, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 70, 70, 101, 101, 101, 70, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 70, 71,
+    0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 101, 0, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101,
+    101, 101, 101, 101, 101, 101, 0, 101, 101, 0, 101, 101, 101, 101, 101, 0, 0, 70, 101, 71, 71,
+    71, 70, 70, 70, 70, 70, 0, 70, 70, 71, 0, 71, 71, 70, 0, 0, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 101, 101, 70, 70, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 18, 20, 0, 0, 0,
+    0, 0, 0, 0, 101, 70, 70, 70, 70, 70, 70, 0, 70, 71, 71, 0, 101, 101, 101, 101, 101, 101, 101,
+    101, 0, 0, 101, 101, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 0,
+    101, 101, 101, 101, 101, 0, 0, 70, 101, 71, 70, 71, 70, 70, 70, 70, 0, 0, 71, 71, 0, 0, 71, 71,
+    70, 0, 0, 0, 0, 0, 0, 0, 70, 70, 71, 0, 0, 0, 0, 101, 101, 0, 101, 101, 101, 70, 70, 0, 0, 73,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 22, 101, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 70, 101, 0, 101, 101, 101, 101, 101, 101, 0, 0, 0, 101, 101, 101, 0, 101, 101, 101, 101, 0,
+    0, 0, 101, 101, 0, 101, 0, 101, 101, 0, 0, 0, 101, 101, 0, 0, 0, 101, 101, 101, 0, 0, 0, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 71, 71, 70, 71, 71, 0, 0, 0,
+    71, 71, 71, 0, 71, 71, 71, 70, 0, 0, 101, 0, 0, 0, 0, 0, 0, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 11, 11, 11, 22, 22, 22, 22, 22, 22, 20, 22, 0,
+    0, 0, 0, 0, 70, 71, 71, 71, 70, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 101, 0,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 0, 0, 70, 101, 70, 70, 70, 71, 71, 71, 71, 0, 70, 70, 70, 0, 70, 70, 70, 70, 0, 0, 0,
+    0, 0, 0, 0, 70, 70, 0, 101, 101, 101, 0, 0, 101, 0, 0, 101, 101, 70, 70, 0, 0, 73, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 0, 0, 0, 18, 11, 11, 11, 11, 11, 11, 11, 22, 101, 70, 71,
+    71, 18, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 101, 0, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 101, 101, 101, 0, 0, 70, 101, 71,
+    70, 71, 71, 71, 71, 71, 0, 70, 71, 71, 0, 71, 71, 70, 70, 0, 0, 0, 0, 0, 0, 0, 71, 71, 0, 0, 0,
+    0, 0, 0, 101, 101, 0, 101, 101, 70, 70, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 101,
+    101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 70, 71, 71, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 0, 101, 101, 101, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 70, 101, 71, 71, 71, 70, 70, 70, 70, 0, 71, 71,
+    71, 0, 71, 71, 71, 70, 101, 22, 0, 0, 0, 0, 101, 101, 101, 71, 11, 11, 11, 11, 11, 11, 11, 101,
+    101, 101, 70, 70, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 22, 101, 101, 101, 101, 101, 101, 0, 70, 71, 71, 0, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 0, 0, 101, 101, 101, 101, 101, 101, 101, 0, 0,
+    0, 70, 0, 0, 0, 0, 71, 71, 71, 70, 70, 70, 0, 70, 0, 71, 71, 71, 71, 71, 71, 71, 71, 0, 0, 0, 0,
+    0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 71, 71, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 101, 69, 70, 70, 70, 70, 70, 70, 70,
+    0, 0, 0, 0, 20, 101, 101, 101, 101, 101, 101, 100, 70, 70, 70, 70, 70, 70, 70, 70, 18, 73, 73,
+    73, 73, 73, 73, 73, 73, 73, 73, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 0, 101, 0, 101, 101, 101, 101,
+    101, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 0, 101, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    70, 101, 69, 70, 70, 70, 70, 70, 70, 70, 70, 70, 101, 0, 0, 101, 101, 101, 101, 101, 0, 100, 0,
+    70, 70, 70, 70, 70, 70, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 101, 101, 101, 101,
+    101, 22, 22, 22, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 22, 18, 22, 22, 22,
+    70, 70, 22, 22, 22, 22, 22, 22, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 22, 70, 22, 70, 22, 70, 14, 15, 14, 15, 71, 71, 101, 101, 101, 101, 101, 101,
+    101, 101, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 0, 0, 0, 0, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 71, 70, 70, 70, 70, 70,
+    18, 70, 70, 101, 101, 101, 101, 101, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 0, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 0, 22, 22, 22, 22, 22, 22, 22, 22, 70, 22, 22, 22, 22, 22,
+    22, 0, 22, 22, 18, 18, 18, 18, 18, 22, 22, 22, 22, 18, 18, 0, 0, 0, 0, 0, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 71, 71, 70, 70, 70, 70, 71, 70, 70, 70, 70, 70, 70, 71, 70,
+    70, 71, 71, 70, 70, 101, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 18, 18, 18, 18, 18, 18, 101,
+    101, 101, 101, 101, 101, 71, 71, 70, 70, 101, 101, 101, 101, 70, 70, 70, 101, 71, 71, 71, 101,
+    101, 71, 71, 71, 71, 71, 71, 71, 101, 101, 101, 70, 70, 70, 70, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 70, 71, 71, 70, 70, 71, 71, 71, 71, 71, 71, 70, 101, 71, 73,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 71, 71, 71, 70, 22, 22, 97, 97, 97, 97, 97, 97, 0, 97, 0, 0,
+    0, 0, 0, 97, 0, 0, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    18, 100, 98, 98, 98, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 101, 101, 0, 0,
+    101, 101, 101, 101, 101, 101, 101, 0, 101, 0, 101, 101, 101, 101, 0, 0, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 0, 101, 101, 101, 101, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 0, 101, 101, 101, 101, 0, 0, 101, 101, 101, 101, 101, 101, 101, 0, 101,
+    0, 101, 101, 101, 101, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 101, 101, 0, 0, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 70, 70, 70, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 75, 75, 75, 75, 75, 75, 75, 75, 75, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 0, 0, 98, 98, 98, 98, 98, 98, 0, 0, 13, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 22, 18, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 151, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 14, 15, 0, 0, 0, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 18, 18, 18, 106, 106, 106, 101, 101, 101, 101, 101, 101,
+    101, 101, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 70, 70, 70, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 70, 71, 18, 18, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 70, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 0, 101, 101, 101, 0, 70, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 70, 70, 71, 70, 70, 70, 70, 70, 70, 70, 71, 71, 71, 71, 71, 71, 71, 71, 70, 71, 71, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 18, 18, 18, 100, 18, 18, 18, 20, 101, 70, 0, 0, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0,
+    0, 0, 0, 18, 18, 18, 18, 18, 18, 13, 18, 18, 18, 18, 70, 70, 70, 27, 70, 73, 73, 73, 73, 73, 73,
+    73, 73, 73, 73, 0, 0, 0, 0, 0, 0, 101, 101, 101, 100, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 102, 102, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 101, 0, 0, 0, 0, 0,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 70,
+    70, 70, 71, 71, 71, 71, 70, 70, 71, 71, 71, 0, 0, 0, 0, 71, 71, 70, 71, 71, 71, 71, 71, 71, 70,
+    70, 70, 0, 0, 0, 0, 22, 0, 0, 0, 18, 18, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 75, 0, 0, 0, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 70, 71, 71, 70, 0, 0, 18, 18, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 71, 70, 71, 70, 70, 70, 70, 70, 70, 70, 0, 70, 71, 70, 71, 71, 70, 70, 70, 70, 70, 70, 70,
+    70, 71, 71, 71, 71, 71, 71, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 0, 0, 70, 73, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 0,
+    0, 18, 18, 18, 18, 18, 18, 18, 100, 18, 18, 18, 18, 18, 18, 0, 0, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 8, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 70, 70, 70, 71, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 70, 71, 70, 70, 70, 70, 70, 71, 70, 71, 71, 71, 71, 71, 70, 71, 71, 101,
+    101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 18, 18, 18,
+    18, 18, 18, 18, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 70, 70, 70, 70, 70, 70, 70, 70, 70, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 18, 18, 0, 70, 70, 71, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 71, 70, 70, 70, 70, 71, 71, 70, 70, 71, 70, 70, 70, 101, 101, 73, 73, 73, 73, 73,
+    73, 73, 73, 73, 73, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 71, 70, 70,
+    71, 71, 71, 70, 71, 70, 70, 70, 71, 71, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 101, 101, 101,
+    101, 71, 71, 71, 71, 71, 71, 71, 71, 70, 70, 70, 70, 70, 70, 70, 70, 71, 71, 70, 70, 0, 0, 0,
+    18, 18, 18, 18, 18, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 101, 101, 101, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 73, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 100, 100,
+    100, 100, 100, 100, 18, 18, 98, 98, 98, 98, 98, 98, 98, 98, 98, 0, 0, 0, 0, 0, 0, 0, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 0, 0, 97, 97, 97, 18, 18, 18,
+    18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 70, 70, 70, 18, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 71, 70, 70, 70, 70, 70, 70, 70, 101, 101, 101, 101, 70, 101, 101, 101, 101, 101,
+    101, 70, 101, 101, 71, 70, 70, 101, 0, 0, 0, 0, 0, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 100, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 100, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 100, 100, 100, 100, 100, 97, 98, 97, 98, 97, 98, 97, 98, 97,
+    98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 98, 98, 98, 98, 98, 98, 98, 98, 97, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 97, 97, 97, 97, 97, 97, 97, 97, 98, 98, 98, 98, 98, 98, 0, 0, 97,
+    97, 97, 97, 97, 97, 0, 0, 98, 98, 98, 98, 98, 98, 98, 98, 97, 97, 97, 97, 97, 97, 97, 97, 98,
+    98, 98, 98, 98, 98, 98, 98, 97, 97, 97, 97, 97, 97, 97, 97, 98, 98, 98, 98, 98, 98, 0, 0, 97,
+    97, 97, 97, 97, 97, 0, 0, 98, 98, 98, 98, 98, 98, 98, 98, 0, 97, 0, 97, 0, 97, 0, 97, 98, 98,
+    98, 98, 98, 98, 98, 98, 97, 97, 97, 97, 97, 97, 97, 97, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 0, 0, 98, 98, 98, 98, 98, 98, 98, 98, 99, 99, 99, 99, 99, 99, 99, 99, 98, 98,
+    98, 98, 98, 98, 98, 98, 99, 99, 99, 99, 99, 99, 99, 99, 98, 98, 98, 98, 98, 98, 98, 98, 99, 99,
+    99, 99, 99, 99, 99, 99, 98, 98, 98, 98, 98, 0, 98, 98, 97, 97, 97, 97, 99, 21, 98, 21, 21, 21,
+    98, 98, 98, 0, 98, 98, 97, 97, 97, 97, 99, 21, 21, 21, 98, 98, 98, 98, 0, 0, 98, 98, 97, 97, 97,
+    97, 0, 21, 21, 21, 98, 98, 98, 98, 98, 98, 98, 98, 97, 97, 97, 97, 97, 21, 21, 21, 0, 0, 98, 98,
+    98, 0, 98, 98, 97, 97, 97, 97, 99, 21, 21, 0, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+    151, 27, 27, 27, 27, 27, 13, 13, 13, 13, 13, 13, 18, 18, 16, 17, 14, 16, 16, 17, 14, 16, 18, 18,
+    18, 18, 18, 18, 18, 18, 152, 153, 27, 27, 27, 27, 27, 151, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    16, 17, 18, 18, 18, 18, 76, 76, 18, 18, 18, 19, 14, 15, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 19, 18, 76, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 151, 27, 27, 27, 27, 27, 0, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 11, 100, 0, 0, 11, 11, 11, 11, 11, 11, 19, 19, 19, 14, 15, 100, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 19, 19, 19, 14, 15, 0, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 0, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 8, 8, 8, 8, 70, 8,
+    8, 8, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 22, 22, 97, 22, 22, 22, 22, 97, 22, 22, 98, 97, 97, 97, 98, 98, 97, 97, 97, 98, 22, 97, 22,
+    22, 115, 97, 97, 97, 97, 97, 22, 22, 22, 22, 22, 22, 97, 22, 97, 22, 97, 22, 97, 97, 97, 97,
+    118, 98, 97, 97, 97, 97, 98, 101, 101, 101, 101, 98, 22, 22, 98, 98, 97, 97, 19, 19, 19, 19, 19,
+    97, 98, 98, 98, 98, 22, 19, 22, 22, 98, 22, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+    106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 97,
+    98, 106, 106, 106, 106, 11, 22, 22, 0, 0, 0, 0, 19, 19, 19, 19, 19, 22, 22, 22, 22, 22, 19, 19,
+    22, 22, 22, 22, 19, 22, 22, 19, 22, 22, 19, 22, 22, 22, 22, 22, 22, 22, 19, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 19, 19, 22, 22, 19, 22, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 22, 22, 22, 22, 22, 22, 22, 22, 14, 15, 14, 15,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 22, 22,
+    22, 22, 22, 22, 22, 14, 15, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 19, 19, 19, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 19, 19, 19, 19, 19,
+    19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 14, 15, 14, 15, 14, 15, 14,
+    15, 14, 15, 14, 15, 14, 15, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 19, 19, 19, 19, 19, 14, 15, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 14, 15, 14, 15, 14, 15, 14, 15, 14,
+    15, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 14, 15, 14, 15, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 14, 15, 19, 19, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 22, 22, 19, 19, 19, 19, 19, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 97, 98, 97, 97, 97, 98, 98, 97, 98, 97, 98, 97, 98, 97, 97, 97, 97, 98, 97, 98, 98, 97, 98,
+    98, 98, 98, 98, 98, 100, 100, 97, 97, 97, 98, 97, 98, 98, 22, 22, 22, 22, 22, 22, 97, 98, 97,
+    98, 70, 70, 70, 97, 98, 0, 0, 0, 0, 0, 18, 18, 18, 18, 11, 18, 18, 98, 98, 98, 98, 98, 98, 0,
+    98, 0, 0, 0, 0, 0, 98, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 100, 18, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101,
+    101, 101, 101, 101, 0, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 101, 101, 101, 101, 101,
+    0, 101, 101, 101, 101, 101, 101, 101, 0, 18, 18, 16, 17, 16, 17, 18, 18, 18, 16, 17, 18, 16, 17,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 13, 18, 18, 13, 18, 16, 17, 18, 18, 16, 17, 14, 15, 14, 15,
+    14, 15, 14, 15, 18, 18, 18, 18, 18, 4, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 13, 13, 18, 18,
+    18, 18, 13, 18, 14, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 22, 22, 18, 18, 18, 14,
+    15, 14, 15, 14, 15, 14, 15, 13, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 0, 0, 0, 0, 151, 18, 18, 18, 22, 100, 101, 106, 14, 15, 14, 15, 14, 15, 14,
+    15, 14, 15, 22, 22, 14, 15, 14, 15, 14, 15, 14, 15, 13, 14, 15, 15, 22, 106, 106, 106, 106, 106,
+    106, 106, 106, 106, 70, 70, 70, 70, 71, 71, 13, 100, 100, 100, 100, 100, 22, 22, 106, 106, 106,
+    100, 101, 18, 22, 22, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 70, 70, 21, 21, 100, 100, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 18, 100, 100, 100, 101, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 22, 22, 11, 11, 11, 11, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 11, 11, 11, 11, 11, 11, 11, 11, 22, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 100, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 100, 18, 18, 18, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 101, 70,
+    8, 8, 8, 18, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 18, 100, 97, 98, 97, 98, 97, 98, 97, 98,
+    97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 100, 100, 70,
+    70, 101, 101, 101, 101, 101, 101, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 70, 70, 18,
+    18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 100, 100, 100, 100, 100, 100, 100, 100, 100, 21, 21, 97,
+    98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 98, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97,
+    98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 100, 98, 98,
+    98, 98, 98, 98, 98, 98, 97, 98, 97, 98, 97, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 100, 21, 21,
+    97, 98, 97, 98, 101, 97, 98, 97, 98, 98, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 98, 97,
+    98, 97, 98, 97, 98, 97, 98, 97, 97, 97, 97, 97, 98, 97, 97, 97, 97, 97, 98, 97, 98, 97, 98, 97,
+    98, 97, 98, 97, 98, 97, 98, 97, 98, 97, 97, 97, 97, 98, 97, 98, 0, 0, 0, 0, 0, 97, 98, 0, 98, 0,
+    98, 97, 98, 97, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100,
+    100, 100, 97, 98, 101, 100, 100, 98, 101, 101, 101, 101, 101, 101, 101, 70, 101, 101, 101, 70,
+    101, 101, 101, 101, 70, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 71, 71, 70, 70, 71, 22, 22, 22, 22, 70, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 22, 22, 20, 22, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 18, 18, 18, 18, 0, 0, 0, 0, 0,
+    0, 0, 0, 71, 71, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 70, 70, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 0, 0, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 101, 101, 101, 101, 101, 101, 18, 18, 18, 101, 18, 101, 101, 70, 101,
+    101, 101, 101, 101, 101, 70, 70, 70, 70, 70, 70, 70, 70, 18, 18, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 71, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 70, 71, 71, 70, 70, 70, 70, 71, 71, 70, 70, 71, 71, 71,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 100, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    73, 0, 0, 0, 0, 18, 18, 101, 101, 101, 101, 101, 70, 100, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 101, 101, 101, 101, 101, 0, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 70, 70, 70, 70, 70, 70, 71, 71, 70, 70, 71, 71, 70, 70, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 101, 101, 101, 70, 101, 101, 101, 101, 101, 101, 101, 101, 70, 71, 0, 0, 73,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 18, 18, 18, 18, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 100, 101, 101, 101, 101, 101, 101, 22, 22, 22, 101,
+    71, 70, 71, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 70, 101, 70, 70, 70, 101, 101, 70, 70, 101, 101, 101, 101, 101, 70, 70, 101, 70, 101, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 100, 18, 18, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 71, 70, 70, 71, 71, 18, 18, 101, 100, 100, 71,
+    70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 0, 0, 101, 101, 101, 101, 101,
+    101, 0, 0, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101,
+    101, 101, 0, 101, 101, 101, 101, 101, 101, 101, 0, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 21, 100, 100, 100, 100, 98, 98, 98, 98, 98, 98, 98, 98, 98, 100,
+    21, 21, 0, 0, 0, 0, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 101, 101,
+    101, 71, 71, 70, 71, 71, 70, 71, 71, 18, 71, 70, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 98, 98, 98, 98, 98, 98, 98, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 98, 98, 98, 98, 0, 0, 0, 0, 0, 101, 70, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 19, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 0, 101, 101, 101, 101, 101, 0, 101, 0, 101, 101, 0, 101, 101, 0, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 5, 5, 5, 5, 5, 5, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 15, 14, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 5, 5, 20, 22, 22, 22, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 18, 18, 18, 18, 18, 18, 18, 14, 15, 18, 0, 0, 0, 0, 0, 0, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 18, 13, 13, 76, 76, 14, 15, 14, 15, 14, 15, 14, 15, 14,
+    15, 14, 15, 14, 15, 14, 15, 18, 18, 14, 15, 18, 18, 18, 18, 76, 76, 76, 18, 18, 18, 0, 18, 18,
+    18, 18, 13, 14, 15, 14, 15, 14, 15, 18, 18, 18, 19, 13, 19, 19, 19, 0, 18, 20, 18, 18, 0, 0, 0,
+    0, 5, 101, 5, 101, 5, 0, 5, 101, 5, 101, 5, 101, 5, 101, 5, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 0, 0, 27, 0, 18, 18, 18, 20, 18, 18, 18, 14, 15, 18, 19, 18, 13, 18, 18, 73,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 18, 18, 19, 19, 19, 18, 21, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 14, 19, 15, 19, 14, 15,
+    18, 14, 15, 18, 18, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 100, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 68, 68, 0, 0, 101, 101, 101, 101, 101, 101, 0, 0, 101, 101, 101, 101, 101, 101,
+    0, 0, 101, 101, 101, 101, 101, 101, 0, 0, 101, 101, 101, 0, 0, 0, 20, 20, 19, 21, 22, 20, 20, 0,
+    22, 19, 19, 19, 19, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 27, 27, 22, 22, 0, 0, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    0, 101, 101, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 0, 0, 0, 0, 0, 18, 18, 18, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+    106, 106, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    11, 11, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 70, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0,
+    0, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 106, 101, 101, 101, 101, 101, 101, 101, 101,
+    106, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 70, 70, 70, 70, 70, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 0, 18, 101, 101, 101, 101, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101,
+    18, 106, 106, 106, 106, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 97, 97, 97, 97, 97, 97, 97, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 0, 0, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 0, 0, 0, 0, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 0, 0, 0, 0, 101,
+    101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 18, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 0, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 0, 97, 97, 97, 97, 97, 97, 97, 0, 97, 97, 0, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 0, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 0, 98, 98, 98, 98,
+    98, 98, 98, 0, 98, 98, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 100, 100, 100, 100, 100, 0, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 0, 100, 100, 100, 100, 100, 100, 100, 100, 100, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101,
+    101, 0, 0, 101, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 0, 0, 0, 101, 0, 0, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 0, 18, 11, 11, 11, 11, 11, 11, 11, 11, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 22, 22, 11, 11, 11, 11,
+    11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 0, 101, 101, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 11, 11, 11,
+    11, 11, 11, 0, 0, 0, 18, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 18, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 0, 0, 0, 0, 11, 11, 101, 101, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 101, 70, 70, 70, 0, 70,
+    70, 0, 0, 0, 0, 0, 70, 70, 70, 70, 101, 101, 101, 101, 0, 101, 101, 101, 0, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 0, 0, 70, 70, 70, 0, 0, 0, 0, 70, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 11, 11, 18, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    11, 11, 11, 101, 101, 101, 101, 101, 101, 101, 101, 22, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 70, 70, 0, 0, 0, 0, 11, 11, 11, 11, 11, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 11, 11, 11, 11, 11,
+    11, 11, 11, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 101, 101, 101, 101, 70, 70,
+    70, 70, 0, 0, 0, 0, 0, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 0, 0, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 70, 70, 13, 0,
+    0, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 101, 0, 0, 0,
+    0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 11, 11, 11, 11, 18,
+    18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 70, 70, 70, 18,
+    18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101,
+    101, 101, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 71, 70, 71, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 73, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 70, 101, 101, 70, 70, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 71, 71, 71, 70, 70, 70, 70, 71,
+    71, 70, 70, 18, 18, 27, 18, 18, 18, 18, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 0,
+    0, 70, 70, 70, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 70, 70, 70, 70, 70, 71, 70, 70, 70, 70, 70, 70, 70, 70, 0, 73, 73, 73, 73, 73, 73, 73, 73,
+    73, 73, 18, 18, 18, 18, 101, 71, 71, 101, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 18, 18, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    71, 71, 71, 70, 70, 70, 70, 70, 70, 70, 70, 70, 71, 71, 101, 101, 101, 101, 18, 18, 18, 18, 70,
+    70, 70, 70, 18, 71, 70, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 101, 18, 101, 18, 18, 18, 0, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 71, 71, 71, 70, 70, 70, 71, 71, 70, 71, 70, 70, 18, 18,
+    18, 18, 18, 18, 70, 0, 101, 101, 101, 101, 101, 101, 101, 0, 101, 0, 101, 101, 101, 101, 0, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 18, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    70, 71, 71, 71, 70, 70, 70, 70, 70, 70, 70, 70, 0, 0, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73,
+    73, 73, 0, 0, 0, 0, 0, 0, 70, 70, 71, 71, 0, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 101,
+    101, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 0, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 0, 101, 101, 101,
+    101, 101, 0, 70, 70, 101, 71, 71, 70, 71, 71, 71, 71, 0, 0, 71, 71, 0, 0, 71, 71, 71, 0, 0, 101,
+    0, 0, 0, 0, 0, 0, 71, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 71, 71, 0, 0, 70, 70, 70, 70, 70,
+    70, 70, 0, 0, 0, 70, 70, 70, 70, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 71, 71, 71, 70,
+    70, 70, 70, 70, 70, 70, 70, 71, 71, 70, 70, 70, 71, 70, 101, 101, 101, 101, 18, 18, 18, 18, 18,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 18, 18, 0, 18, 70, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 71, 71, 71, 70, 70, 70, 70, 70, 70, 71,
+    70, 71, 71, 71, 71, 70, 70, 71, 70, 70, 101, 101, 18, 101, 0, 0, 0, 0, 0, 0, 0, 0, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 71, 71, 71, 70, 70, 70, 70, 0, 0, 71, 71, 71, 71, 70, 70, 71, 70, 70,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 101,
+    101, 101, 101, 70, 70, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 71, 71, 71, 70, 70, 70, 70, 70, 70, 70, 70, 71, 71, 70, 71, 70, 70, 18, 18, 18,
+    101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 71, 70, 71, 71, 70, 70,
+    70, 70, 70, 70, 71, 70, 101, 18, 0, 0, 0, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 71, 70, 70, 70, 70, 71, 70, 70,
+    70, 70, 70, 0, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 11, 11, 18, 18, 18, 22, 101,
+    101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 71, 71, 71, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 71, 70, 70, 18, 0, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101,
+    101, 101, 0, 0, 101, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 0, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 71, 71, 71, 71, 71, 71, 0, 71, 71, 0, 0, 70, 70, 71, 70, 101, 71, 101, 71, 70,
+    18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 0, 0,
+    101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 71, 71, 71, 70, 70, 70, 70, 0, 0, 70, 70, 71,
+    71, 71, 71, 70, 101, 18, 101, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 101, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 70, 70, 70, 70,
+    70, 71, 101, 70, 70, 70, 70, 18, 18, 18, 18, 18, 18, 18, 18, 70, 0, 0, 0, 0, 0, 0, 0, 0, 101,
+    70, 70, 70, 70, 70, 70, 71, 71, 70, 70, 70, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 71, 70, 70, 18, 18, 18,
+    101, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    71, 70, 70, 70, 70, 70, 70, 70, 0, 70, 70, 70, 70, 70, 70, 71, 70, 101, 18, 18, 18, 18, 18, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 18, 18, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 0, 0, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 0, 71, 70, 70, 70, 70, 70, 70, 70, 71, 70, 70, 71, 70, 70, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 0, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 70, 70, 70, 70, 70, 0, 0,
+    0, 70, 0, 70, 70, 0, 70, 70, 70, 70, 70, 70, 70, 101, 70, 0, 0, 0, 0, 0, 0, 0, 0, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 0, 101, 101, 0, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 71, 71, 71, 71, 71, 0, 70, 70, 0,
+    71, 71, 70, 71, 70, 101, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 70, 71, 71, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22,
+    22, 22, 22, 22, 20, 20, 20, 20, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+    106, 106, 106, 106, 106, 0, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101,
+    101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 18, 18, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 0, 27, 27, 27, 27, 27, 27, 27, 27, 27, 0, 0, 0, 0, 0, 0, 0, 73, 73, 73, 73, 73, 73,
+    73, 73, 73, 73, 0, 0, 0, 0, 18, 18, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 0, 0, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 70, 70, 70, 70, 70, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 70, 70,
+    70, 70, 70, 70, 18, 18, 18, 18, 18, 22, 22, 22, 22, 100, 100, 100, 100, 18, 22, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 11, 11, 11, 11, 11, 11, 11, 0, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 18, 18, 18, 18, 0, 0, 0, 0, 0,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 70, 101, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    71, 71, 0, 0, 0, 0, 0, 0, 0, 70, 70, 70, 70, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 18, 100, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 71, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 100, 100, 100, 0, 100, 100, 100, 100, 100, 100, 100, 0, 100,
+    100, 0, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 0, 0, 22, 70, 70, 18, 27, 27, 27, 27, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 0, 0, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 71, 71, 70, 70, 70,
+    22, 22, 22, 71, 71, 71, 71, 71, 71, 27, 27, 27, 27, 27, 27, 27, 27, 70, 70, 70, 70, 70, 70, 70,
+    70, 22, 22, 70, 70, 70, 70, 70, 70, 70, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 70, 70, 70, 70, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 70, 70, 70, 22, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 98, 98, 98, 98, 98, 98, 98, 0, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 97, 0, 97,
+    97, 0, 0, 97, 0, 0, 97, 97, 0, 0, 97, 97, 97, 97, 0, 97, 97, 97, 97, 97, 97, 97, 97, 98, 98, 98,
+    98, 0, 98, 0, 98, 98, 98, 98, 98, 98, 98, 0, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 97, 97, 0, 97, 97, 97, 97, 0, 0, 97, 97, 97, 97, 97, 97, 97, 97, 0, 97, 97, 97, 97, 97,
+    97, 97, 0, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 97, 97, 0, 97, 97, 97, 97, 0, 97, 97, 97, 97, 97, 0, 97, 0, 0, 0, 97, 97,
+    97, 97, 97, 97, 97, 0, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 97, 97, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 98, 98, 98, 98,
+    98, 98, 0, 0, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 19, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 19, 98, 98, 98, 98, 98, 98, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 19, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 19, 98, 98, 98, 98, 98, 98,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 19, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 19, 98, 98, 98, 98, 98, 98, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 19, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 19, 98, 98, 98, 98, 98, 98, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 19, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 19,
+    98, 98, 98, 98, 98, 98, 97, 98, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 22, 22, 22, 22, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 22, 22, 22, 22, 22, 22, 22, 22, 70, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 70, 22, 22, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 70, 70, 70, 70, 70, 0, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 101, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 0, 70, 70, 70, 70,
+    70, 70, 70, 0, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 0, 0, 70, 70,
+    70, 70, 70, 70, 70, 0, 70, 70, 0, 70, 70, 70, 70, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0,
+    70, 70, 70, 70, 70, 70, 70, 100, 100, 100, 100, 100, 100, 100, 0, 0, 73, 73, 73, 73, 73, 73, 73,
+    73, 73, 73, 0, 0, 0, 0, 101, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 70, 70, 70, 70, 73,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 0, 20, 101, 101, 101, 101, 101, 101, 101, 0,
+    101, 101, 101, 101, 0, 101, 101, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 0, 101, 101, 101, 101, 101, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 70, 70, 70,
+    70, 70, 70, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 97, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 70,
+    70, 70, 70, 70, 70, 70, 100, 0, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 18,
+    18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 11, 11, 11, 20, 11, 11,
+    11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 22, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    0, 0, 101, 101, 101, 101, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 0, 101, 0, 0,
+    101, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 101, 101, 0, 101, 0, 101,
+    0, 0, 0, 0, 0, 0, 101, 0, 0, 0, 0, 101, 0, 101, 0, 101, 0, 101, 101, 101, 0, 101, 101, 0, 101,
+    0, 0, 101, 0, 101, 0, 101, 0, 101, 0, 101, 0, 101, 101, 0, 101, 0, 0, 101, 101, 101, 101, 0,
+    101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 101, 101, 0, 101, 101, 101, 101, 0, 101, 0, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 101, 101, 101, 0, 101, 101, 101, 101,
+    101, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 22, 22, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22,
+    22, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 22, 22,
+    22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 22, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0,
+    22, 22, 22, 22, 22, 0, 0, 0, 22, 22, 22, 22, 22, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0,
+    0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22,
+    22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 0, 0, 101,
+    101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 0, 0,
+};
+
+inline constexpr std::uint_least8_t unicode_database_ascii[] = {
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 154, 154, 154, 154, 154, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 151, 18, 18, 18, 20, 18, 18, 18, 14, 15, 18, 19, 18, 13, 18,
+    18, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 18, 18, 19, 19, 19, 18, 18, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 14, 18, 15, 21,
+    76, 21, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 14, 19, 15, 19, 26,
+};
+
+// Returns the byte of the code point, which must be valid.
+constexpr std::uint_least8_t unicode_database_lookup(char32_t cp)
+{
+    auto stage2 = unicode_database_stage1[cp >> 9];
+    auto stage3 = unicode_database_stage2[stage2 * 16u + ((cp >> 5) & 15u)];
+    return unicode_database_stage3[stage3 * 32u + (cp & 31u)];
+}
+} // namespace lexy::_detail
+
+#endif // LEXY_DETAIL_UNICODE_DATABASE_HPP_INCLUDED
@@ -397,18 +397,18 @@ struct _list
         using return_type = T;
 
         template <typename U>
-        auto operator()(U&& obj) -> decltype(_result.push_back(LEXY_FWD(obj)))
+        constexpr auto operator()(U&& obj) -> decltype(_result.push_back(LEXY_FWD(obj)))
         {
             return _result.push_back(LEXY_FWD(obj));
         }
 
         template <typename... Args>
-        void operator()(Args&&... args)
+        constexpr void operator()(Args&&... args)
         {
             _result.emplace_back(LEXY_FWD(args)...);
         }
 
-        T&& finish() &&
+        constexpr T&& finish() &&
         {
             return LEXY_MOV(_result);
         }
@@ -436,18 +436,18 @@ struct _collection
         using return_type = T;
 
         template <typename U>
-        auto operator()(U&& obj) -> decltype(_result.insert(LEXY_FWD(obj)))
+        constexpr auto operator()(U&& obj) -> decltype(_result.insert(LEXY_FWD(obj)))
         {
             return _result.insert(LEXY_FWD(obj));
         }
 
         template <typename... Args>
-        void operator()(Args&&... args)
+        constexpr void operator()(Args&&... args)
         {
             _result.emplace(LEXY_FWD(args)...);
         }
 
-        T&& finish() &&
+        constexpr T&& finish() &&
         {
             return LEXY_MOV(_result);
         }
@@ -609,36 +609,40 @@ struct _as_string
         using return_type = String;
 
         template <typename CharT>
-        auto operator()(CharT c) -> decltype(_result.push_back(c))
+        constexpr auto operator()(CharT c) -> decltype(_result.push_back(c))
         {
             return _result.push_back(c);
         }
 
-        void operator()(const String& str)
+        constexpr void operator()(const String& str)
         {
             _result.append(str);
         }
-        void operator()(String&& str)
+        constexpr void operator()(String&& str)
         {
             _result.append(LEXY_MOV(str));
         }
 
         template <typename CharT>
-        auto operator()(const CharT* str, std::size_t length)
+        constexpr auto operator()(const CharT* str, std::size_t length)
             -> decltype(_result.append(str, length))
         {
             return _result.append(str, length);
         }
 
         template <typename Reader>
-        void operator()(lexeme<Reader> lex)
+        constexpr void operator()(lexeme<Reader> lex)
         {
             using iterator = typename lexeme<Reader>::iterator;
             if constexpr (std::is_pointer_v<iterator>)
             {
                 static_assert(lexy::char_type_compatible_with_reader<Reader, _char_type>,
                               "cannot convert lexeme to this string type");
-                _result.append(reinterpret_cast<const _char_type*>(lex.data()), lex.size());
+
+                if constexpr (std::is_same_v<_char_type, typename Reader::encoding::char_type>)
+                    _result.append(lex.data(), lex.size());
+                else
+                    _result.append(reinterpret_cast<const _char_type*>(lex.data()), lex.size());
             }
             else
             {
@@ -648,14 +652,18 @@ struct _as_string
             }
         }
 
-        void operator()(code_point cp)
+        constexpr void operator()(code_point cp)
         {
             typename Encoding::char_type buffer[4] = {};
             auto                         size      = Encoding::encode_code_point(cp, buffer, 4);
-            (*this)(reinterpret_cast<const _char_type*>(buffer), size);
+
+            if constexpr (std::is_same_v<_char_type, typename Encoding::char_type>)
+                (*this)(buffer, size);
+            else
+                (*this)(reinterpret_cast<const _char_type*>(buffer), size);
         }
 
-        String&& finish() &&
+        constexpr String&& finish() &&
         {
             return LEXY_MOV(_result);
         }
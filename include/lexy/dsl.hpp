@@ -15,6 +15,7 @@
 #include <lexy/dsl/choice.hpp>
 #include <lexy/dsl/code_point.hpp>
 #include <lexy/dsl/combination.hpp>
+#include <lexy/dsl/commit.hpp>
 #include <lexy/dsl/context.hpp>
 #include <lexy/dsl/context_counter.hpp>
 #include <lexy/dsl/context_flag.hpp>
@@ -28,6 +29,7 @@
 #include <lexy/dsl/if.hpp>
 #include <lexy/dsl/integer.hpp>
 #include <lexy/dsl/label.hpp>
+#include <lexy/dsl/lazy.hpp>
 #include <lexy/dsl/list.hpp>
 #include <lexy/dsl/literal.hpp>
 #include <lexy/dsl/lookahead.hpp>
@@ -39,6 +41,7 @@
 #include <lexy/dsl/peek.hpp>
 #include <lexy/dsl/position.hpp>
 #include <lexy/dsl/production.hpp>
+#include <lexy/dsl/profiled_choice.hpp>
 #include <lexy/dsl/punctuator.hpp>
 #include <lexy/dsl/recover.hpp>
 #include <lexy/dsl/return.hpp>
@@ -50,6 +53,7 @@
 #include <lexy/dsl/terminator.hpp>
 #include <lexy/dsl/times.hpp>
 #include <lexy/dsl/token.hpp>
+#include <lexy/dsl/unicode.hpp>
 #include <lexy/dsl/until.hpp>
 #include <lexy/dsl/value.hpp>
 #include <lexy/dsl/while.hpp>
@@ -93,6 +93,24 @@ struct _alt_engine<_alt_impl<Lits...>, _alt_impl<Tokens...>>
             reader = LEXY_MOV(longest_reader);
             return error_code();
         }
+
+        template <typename Encoding>
+        static constexpr bool _has_start_filter
+            = (lexy::engine_has_start_filter<typename Tokens::token_engine, Encoding> && ...);
+
+        // Only available if all tokens have one.
+        template <typename Encoding, typename = std::enable_if_t<_has_start_filter<Encoding>>>
+        static constexpr bool can_start_with(typename Encoding::int_type c)
+        {
+            if constexpr (sizeof...(Lits) > 0)
+            {
+                if (lexy::engine_trie<_alt_trie<Lits...>::trie>::template can_start_with<Encoding>(
+                        c))
+                    return true;
+            }
+
+            return (Tokens::token_engine::template can_start_with<Encoding>(c) || ...);
+        }
     };
 };
 template <typename... Lits, typename... Tokens, typename H, typename... T>
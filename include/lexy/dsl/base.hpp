@@ -7,12 +7,24 @@
 
 #include <lexy/_detail/assert.hpp>
 #include <lexy/_detail/config.hpp>
+#include <lexy/_detail/detect.hpp>
 #include <lexy/_detail/lazy_init.hpp>
 #include <lexy/engine/base.hpp>
 #include <lexy/input/base.hpp>
 #include <lexy/production.hpp>
 
-#define LEXY_DSL_FUNC LEXY_FORCE_INLINE static constexpr
+#if LEXY_INLINE_POLICY == LEXY_INLINE_POLICY_COMPILER
+#    define LEXY_DSL_FUNC static constexpr
+#else
+#    define LEXY_DSL_FUNC LEXY_FORCE_INLINE static constexpr
+#endif
+
+// The functions that parse the rule of a production.
+#if LEXY_INLINE_POLICY == LEXY_INLINE_POLICY_PRODUCTION
+#    define LEXY_PRODUCTION_FUNC LEXY_NOINLINE constexpr
+#else
+#    define LEXY_PRODUCTION_FUNC constexpr
+#endif
 
 #ifdef LEXY_IGNORE_DEPRECATED_ERROR
 #    define LEXY_DEPRECATED_ERROR(msg)
@@ -375,6 +387,22 @@ struct context_discard_parser
         return true;
     }
 };
+
+template <typename Handler, typename Context, typename Reader>
+using _detect_check_budget = decltype(LEXY_DECLVAL(Handler&).check_budget(
+    LEXY_DECLVAL(Context&), LEXY_DECLVAL(const Reader&)));
+
+// Called after a production has been started, in every iteration of a loop and before recovery.
+// The handler can stop parsing there by raising an error, e.g. to enforce a `lexy::parse_budget`.
+template <typename Context, typename Reader>
+constexpr bool _check_budget(Context& context, const Reader& reader)
+{
+    using handler = std::remove_reference_t<decltype(context.handler())>;
+    if constexpr (lexy::_detail::is_detected<_detect_check_budget, handler, Context, Reader>)
+        return context.handler().check_budget(context, reader);
+    else
+        return true;
+}
 } // namespace lexy
 
 namespace lexy::_detail
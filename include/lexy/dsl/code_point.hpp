@@ -91,6 +91,20 @@ struct _cp : token_base<_cp<Predicate>>
         template <typename Reader>
         static constexpr error_code match(Reader& reader)
         {
+            if constexpr (lexy::_detail::cp_has_ascii_fast_path<Predicate>)
+            {
+                // Check an ASCII code point without decoding it.
+                auto c = static_cast<std::uint_least32_t>(reader.peek());
+                if (c <= 0x7F)
+                {
+                    if (!Predicate::_match_ascii(char32_t(c)))
+                        return error_code::invalid;
+
+                    reader.bump();
+                    return error_code();
+                }
+            }
+
             // Parse one code point.
             lexy::engine_cp_auto::error_code ec{};
             [[maybe_unused]] auto            cp = lexy::engine_cp_auto::parse(ec, reader);
@@ -106,6 +120,8 @@ struct _cp : token_base<_cp<Predicate>>
 
             return error_code();
         }
+
+        using while_engine = lexy::engine_cp_while<Predicate>;
     };
 
     template <typename Context, typename Reader>
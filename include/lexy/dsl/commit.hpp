@@ -0,0 +1,37 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_DSL_COMMIT_HPP_INCLUDED
+#define LEXY_DSL_COMMIT_HPP_INCLUDED
+
+#include <lexy/_detail/detect.hpp>
+#include <lexy/dsl/base.hpp>
+
+namespace lexyd
+{
+template <typename Reader>
+using _detect_reader_commit = decltype(LEXY_DECLVAL(Reader&).commit());
+
+struct _commit : rule_base
+{
+    template <typename NextParser>
+    struct parser
+    {
+        template <typename Context, typename Reader, typename... Args>
+        LEXY_DSL_FUNC bool parse(Context& context, Reader& reader, Args&&... args)
+        {
+            if constexpr (lexy::_detail::is_detected<_detect_reader_commit, Reader>)
+                reader.commit();
+            return NextParser::parse(context, reader, LEXY_FWD(args)...);
+        }
+    };
+};
+
+/// Promises that the input before the current position is no longer needed:
+/// it is not backtracked to and not referenced by lexemes or iterators that are still used.
+/// Inputs that read on demand can then release it; for all other inputs, it does nothing.
+constexpr auto commit = _commit{};
+} // namespace lexyd
+
+#endif // LEXY_DSL_COMMIT_HPP_INCLUDED
@@ -0,0 +1,121 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_DSL_LAZY_HPP_INCLUDED
+#define LEXY_DSL_LAZY_HPP_INCLUDED
+
+#include <lexy/dsl/base.hpp>
+#include <lexy/dsl/branch.hpp>
+#include <lexy/dsl/brackets.hpp>
+#include <lexy/dsl/token.hpp>
+#include <lexy/engine/find.hpp>
+#include <lexy/input/range_input.hpp>
+#include <lexy/lexeme.hpp>
+#include <lexy/parse.hpp>
+
+namespace lexy
+{
+/// The content of brackets that was skipped by `dsl::lazy`; it can be parsed as `Production` later.
+template <typename Production, typename Reader>
+class lazy_production
+{
+public:
+    using production = Production;
+    using encoding   = typename Reader::encoding;
+    using iterator   = typename Reader::iterator;
+
+    constexpr lazy_production() noexcept : _begin(), _end() {}
+    constexpr explicit lazy_production(iterator begin, iterator end) noexcept
+    : _begin(begin), _end(end)
+    {}
+
+    /// The skipped content, without the brackets.
+    constexpr auto lexeme() const noexcept
+    {
+        return lexy::lexeme<Reader>(_begin, _end);
+    }
+
+    /// An input for the skipped content, its iterators are the ones of the original input.
+    constexpr auto input() const noexcept
+    {
+        return lexy::range_input<encoding, iterator>(_begin, _end);
+    }
+
+    /// Parses the content as `Production`.
+    /// Like the original input, it must still be alive.
+    template <typename Callback>
+    constexpr auto parse(Callback callback) const
+    {
+        return lexy::parse<Production>(input(), callback);
+    }
+    template <typename State, typename Callback>
+    constexpr auto parse(State&& state, Callback callback) const
+    {
+        return lexy::parse<Production>(input(), LEXY_FWD(state), callback);
+    }
+
+private:
+    iterator _begin, _end;
+};
+} // namespace lexy
+
+namespace lexyd
+{
+template <typename Open, typename Close, typename Production>
+struct _lazy : rule_base
+{
+    template <typename NextParser>
+    struct parser
+    {
+        template <typename Context, typename Reader, typename... Args>
+        LEXY_DSL_FUNC bool parse(Context& context, Reader& reader, Args&&... args)
+        {
+            using open_engine  = typename decltype(lexyd::token(Open{}))::token_engine;
+            using close_engine = typename decltype(lexyd::token(Close{}))::token_engine;
+
+            // The opening bracket has already been parsed, find the matching closing bracket.
+            auto begin = reader.cur();
+            for (auto depth = 0u; true;)
+            {
+                lexy::_find_skip<open_engine, close_engine>(reader);
+
+                auto save = reader;
+                if (lexy::engine_try_match<close_engine>(reader))
+                {
+                    if (depth == 0)
+                    {
+                        // Go back, so we parse the closing bracket for real.
+                        reader = LEXY_MOV(save);
+                        break;
+                    }
+
+                    --depth;
+                }
+                else if (lexy::engine_try_match<open_engine>(reader))
+                    ++depth;
+                else if (reader.eof())
+                    // The closing bracket will raise an error.
+                    break;
+                else
+                    reader.bump();
+            }
+
+            auto end = reader.cur();
+            return lexy::rule_parser<Close, NextParser>::parse(
+                context, reader, LEXY_FWD(args)...,
+                lexy::lazy_production<Production, Reader>(begin, end));
+        }
+    };
+};
+
+/// Parses the open bracket, skips over the content until the matching close bracket,
+/// and produces a `lexy::lazy_production` that can parse the content as `Production` later.
+template <typename Production, typename Open, typename Close, typename... RecoveryLimit>
+LEXY_CONSTEVAL auto lazy(_brackets<Open, Close, RecoveryLimit...> brackets)
+{
+    return brackets.open() >> _lazy<Open, Close, Production>{};
+}
+} // namespace lexyd
+
+#endif // LEXY_DSL_LAZY_HPP_INCLUDED
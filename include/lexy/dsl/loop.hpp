@@ -52,6 +52,9 @@ struct _loop : rule_base
             auto loop_context = context.insert(_break{}, flag{});
             while (!loop_context.get(_break{}).loop_break)
             {
+                if (!lexy::_check_budget(loop_context, reader))
+                    return false;
+
                 using parser
                     = lexy::rule_parser<Rule, lexy::context_discard_parser<decltype(loop_context)>>;
                 if (!parser::parse(loop_context, reader))
@@ -10,14 +10,14 @@
 
 namespace lexyd
 {
-// Not inline: one function per production.
+// Not inline: one function per production, see `LEXY_INLINE_POLICY`.
 template <typename Rule, typename Context, typename Reader>
-constexpr bool _parse(Context& context, Reader& reader)
+LEXY_PRODUCTION_FUNC bool _parse(Context& context, Reader& reader)
 {
     return lexy::rule_parser<Rule, lexy::context_value_parser>::parse(context, reader);
 }
 template <typename Rule, typename Context, typename Reader>
-constexpr auto _try_parse(Context& context, Reader& reader)
+LEXY_PRODUCTION_FUNC auto _try_parse(Context& context, Reader& reader)
 {
     return lexy::rule_parser<Rule, lexy::context_value_parser>::try_parse(context, reader);
 }
@@ -55,6 +55,11 @@ struct _prd_parser
         -> lexy::rule_try_parse_result
     {
         auto prod_context = context.production_context(Production{}, reader.cur());
+        if (!lexy::_check_budget(prod_context, reader))
+        {
+            LEXY_MOV(prod_context).backtrack();
+            return lexy::rule_try_parse_result::canceled;
+        }
 
         if (auto result = _try_parse<Rule>(prod_context, reader);
             result == lexy::rule_try_parse_result::ok)
@@ -77,7 +82,7 @@ struct _prd_parser
     {
         auto prod_context = context.production_context(Production{}, reader.cur());
 
-        if (!_parse<Rule>(prod_context, reader))
+        if (!lexy::_check_budget(prod_context, reader) || !_parse<Rule>(prod_context, reader))
         {
             // We failed to parse, need to backtrack.
             LEXY_MOV(prod_context).backtrack();
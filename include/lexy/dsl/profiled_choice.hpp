@@ -0,0 +1,374 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_DSL_PROFILED_CHOICE_HPP_INCLUDED
+#define LEXY_DSL_PROFILED_CHOICE_HPP_INCLUDED
+
+#include <cstdint>
+#include <lexy/_detail/detect.hpp>
+#include <lexy/_detail/integer_sequence.hpp>
+#include <lexy/_detail/type_name.hpp>
+#include <lexy/dsl/base.hpp>
+#include <lexy/dsl/branch.hpp>
+#include <lexy/dsl/choice.hpp>
+#include <lexy/dsl/literal.hpp>
+#include <lexy/dsl/production.hpp>
+
+// Whether `dsl::profiled_choice` counts how often each alternative is taken.
+// It has to be consistent in the entire program.
+#ifndef LEXY_CHOICE_STATISTICS
+#    define LEXY_CHOICE_STATISTICS 0
+#endif
+
+#if LEXY_CHOICE_STATISTICS
+#    include <atomic>
+#endif
+
+namespace lexy
+{
+#if 0
+/// Specialize it for the tag of a profiled choice to try the alternatives in the profiled order.
+/// It is generated by `lexy_ext::write_choice_profile()`.
+template <>
+struct choice_profile<Tag>
+{
+    /// For each alternative, how often it was taken.
+    static constexpr std::uint64_t hits[] = {...};
+};
+#endif
+template <typename Tag>
+struct choice_profile
+{};
+
+template <typename Profile>
+using _detect_choice_profile = decltype(Profile::hits);
+} // namespace lexy
+
+#if LEXY_CHOICE_STATISTICS
+namespace lexy
+{
+/// The statistics of a profiled choice collected while parsing.
+/// Every profiled choice that was instantiated is registered in a global list.
+class choice_statistics
+{
+public:
+    static choice_statistics* first() noexcept
+    {
+        return _head();
+    }
+    choice_statistics* next() const noexcept
+    {
+        return _next;
+    }
+
+    /// The fully qualified name of the tag.
+    const char* tag_name() const noexcept
+    {
+        return _tag_name;
+    }
+
+    std::size_t alternatives() const noexcept
+    {
+        return _size;
+    }
+    /// How often the alternative was taken.
+    std::uint64_t hits(std::size_t idx) const noexcept
+    {
+        LEXY_PRECONDITION(idx < _size);
+        return _hits[idx].load(std::memory_order_relaxed);
+    }
+    /// How often the alternative was tried but backtracked.
+    std::uint64_t misses(std::size_t idx) const noexcept
+    {
+        LEXY_PRECONDITION(idx < _size);
+        return _misses[idx].load(std::memory_order_relaxed);
+    }
+
+    void reset() noexcept
+    {
+        for (auto i = std::size_t(0); i != _size; ++i)
+        {
+            _hits[i].store(0, std::memory_order_relaxed);
+            _misses[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void record_hit(std::size_t idx) noexcept
+    {
+        _hits[idx].fetch_add(1, std::memory_order_relaxed);
+    }
+    void record_miss(std::size_t idx) noexcept
+    {
+        _misses[idx].fetch_add(1, std::memory_order_relaxed);
+    }
+
+protected:
+    explicit choice_statistics(const char* tag_name, std::size_t size,
+                               std::atomic<std::uint64_t>* hits,
+                               std::atomic<std::uint64_t>* misses) noexcept
+    : _next(_head()), _tag_name(tag_name), _size(size), _hits(hits), _misses(misses)
+    {
+        _head() = this;
+    }
+
+private:
+    static choice_statistics*& _head() noexcept
+    {
+        static choice_statistics* head = nullptr;
+        return head;
+    }
+
+    choice_statistics*          _next;
+    const char*                 _tag_name;
+    std::size_t                 _size;
+    std::atomic<std::uint64_t>* _hits;
+    std::atomic<std::uint64_t>* _misses;
+};
+
+template <typename Tag, std::size_t N>
+class _choice_counters : public choice_statistics
+{
+public:
+    _choice_counters() noexcept
+    : choice_statistics(_detail::make_cstr<_detail::_type_name<Tag, 0>>, N, _hits_storage,
+                        _misses_storage)
+    {}
+
+private:
+    std::atomic<std::uint64_t> _hits_storage[N]   = {};
+    std::atomic<std::uint64_t> _misses_storage[N] = {};
+};
+
+template <typename Tag, std::size_t N>
+inline _choice_counters<Tag, N> _choice_counters_for;
+} // namespace lexy
+#endif
+
+namespace lexyd
+{
+// The literal an alternative starts with, if any.
+template <typename Rule>
+struct _pchc_lit
+{
+    static constexpr auto is_literal = false;
+    static constexpr auto get()
+    {
+        return lexy::_detail::basic_string_view<char32_t>();
+    }
+};
+template <typename String>
+struct _pchc_lit<_lit<String>>
+{
+    static constexpr auto is_literal = true;
+    static constexpr auto get()
+    {
+        return String::template get<char32_t>();
+    }
+};
+template <typename String, typename... R>
+struct _pchc_lit<_br<_lit<String>, R...>> : _pchc_lit<_lit<String>>
+{};
+template <typename Production>
+struct _pchc_lit<_prd<Production>> : _pchc_lit<lexy::production_rule<Production>>
+{};
+
+template <std::size_t N>
+struct _pchc_order
+{
+    std::size_t index[N];
+};
+
+// Computes the order in which the alternatives are tried.
+// Only runs of consecutive alternatives that start with literals, where no literal is a prefix of
+// another, are reordered: at most one of them can match, so their order doesn't matter.
+template <typename Tag, typename... R>
+constexpr auto _pchc_make_order()
+{
+    constexpr auto size = sizeof...(R);
+
+    _pchc_order<size> result{};
+    for (auto i = std::size_t(0); i != size; ++i)
+        result.index[i] = i;
+
+    using profile = lexy::choice_profile<Tag>;
+    if constexpr (lexy::_detail::is_detected<lexy::_detect_choice_profile, profile>)
+    {
+        static_assert(sizeof(profile::hits) / sizeof(profile::hits[0]) == size,
+                      "profile doesn't match the number of alternatives");
+
+        using string_view = lexy::_detail::basic_string_view<char32_t>;
+        constexpr bool        is_literal[] = {_pchc_lit<R>::is_literal...};
+        constexpr string_view literals[]   = {_pchc_lit<R>::get()...};
+        auto prefix_free = [&](std::size_t lhs, std::size_t rhs) {
+            auto a = literals[lhs];
+            auto b = literals[rhs];
+            for (auto i = std::size_t(0); i != a.size() && i != b.size(); ++i)
+                if (a[i] != b[i])
+                    return true;
+            return false;
+        };
+
+        for (auto begin = std::size_t(0); begin != size;)
+        {
+            if (!is_literal[begin])
+            {
+                ++begin;
+                continue;
+            }
+
+            auto end = begin + 1;
+            while (end != size && is_literal[end])
+                ++end;
+
+            auto disjoint = true;
+            for (auto i = begin; i != end; ++i)
+                for (auto j = i + 1; j != end; ++j)
+                    disjoint = disjoint && prefix_free(i, j);
+
+            // Stable insertion sort by descending hits.
+            if (disjoint)
+                for (auto i = begin + 1; i != end; ++i)
+                    for (auto j = i; j != begin
+                                     && profile::hits[result.index[j - 1]]
+                                            < profile::hits[result.index[j]];
+                         --j)
+                    {
+                        auto tmp            = result.index[j];
+                        result.index[j]     = result.index[j - 1];
+                        result.index[j - 1] = tmp;
+                    }
+
+            begin = end;
+        }
+    }
+
+    return result;
+}
+
+template <std::size_t Idx, typename H, typename... T>
+struct _pchc_nth : _pchc_nth<Idx - 1, T...>
+{};
+template <typename H, typename... T>
+struct _pchc_nth<0, H, T...>
+{
+    using type = H;
+};
+
+#if LEXY_CHOICE_STATISTICS
+template <std::size_t Idx, typename Rule>
+struct _pchc_alt
+{};
+
+template <typename NextParser, typename Counters, typename... Alts>
+struct _pchc_parser;
+template <typename NextParser, typename Counters>
+struct _pchc_parser<NextParser, Counters> : _chc_parser<NextParser>
+{};
+template <typename NextParser, typename Counters, std::size_t Idx, typename H, typename... T>
+struct _pchc_parser<NextParser, Counters, _pchc_alt<Idx, H>, T...>
+{
+    template <typename Context, typename Reader, typename... Args>
+    LEXY_DSL_FUNC auto try_parse(Context& context, Reader& reader, Args&&... args)
+        -> lexy::rule_try_parse_result
+    {
+        if constexpr (H::is_unconditional_branch)
+        {
+            Counters::get().record_hit(Idx);
+            if (lexy::rule_parser<H, NextParser>::parse(context, reader, LEXY_FWD(args)...))
+                return lexy::rule_try_parse_result::ok;
+            else
+                return lexy::rule_try_parse_result::canceled;
+        }
+        else
+        {
+            auto result
+                = lexy::rule_parser<H, NextParser>::try_parse(context, reader, LEXY_FWD(args)...);
+            if (result == lexy::rule_try_parse_result::backtracked)
+            {
+                Counters::get().record_miss(Idx);
+                return _pchc_parser<NextParser, Counters, T...>::try_parse(context, reader,
+                                                                           LEXY_FWD(args)...);
+            }
+            else
+            {
+                Counters::get().record_hit(Idx);
+                return result;
+            }
+        }
+    }
+
+    template <typename Context, typename Reader, typename... Args>
+    LEXY_DSL_FUNC bool parse(Context& context, Reader& reader, Args&&... args)
+    {
+        if constexpr (H::is_unconditional_branch)
+        {
+            Counters::get().record_hit(Idx);
+            return lexy::rule_parser<H, NextParser>::parse(context, reader, LEXY_FWD(args)...);
+        }
+        else
+        {
+            auto result
+                = lexy::rule_parser<H, NextParser>::try_parse(context, reader, LEXY_FWD(args)...);
+            if (result == lexy::rule_try_parse_result::backtracked)
+            {
+                Counters::get().record_miss(Idx);
+                return _pchc_parser<NextParser, Counters, T...>::parse(context, reader,
+                                                                       LEXY_FWD(args)...);
+            }
+            else
+            {
+                Counters::get().record_hit(Idx);
+                return static_cast<bool>(result);
+            }
+        }
+    }
+};
+
+template <typename Tag, std::size_t N>
+struct _pchc_counters
+{
+    static lexy::choice_statistics& get() noexcept
+    {
+        return lexy::_choice_counters_for<Tag, N>;
+    }
+};
+#endif
+
+template <typename Tag, typename... R>
+struct _pchc : rule_base
+{
+    static constexpr auto is_branch               = true;
+    static constexpr auto is_unconditional_branch = (R::is_unconditional_branch || ...);
+
+    static constexpr auto _order = _pchc_make_order<Tag, R...>();
+
+    template <typename NextParser, typename Indices>
+    struct _parser;
+    template <typename NextParser, std::size_t... Idx>
+    struct _parser<NextParser, lexy::_detail::index_sequence<Idx...>>
+    {
+#if LEXY_CHOICE_STATISTICS
+        using type = _pchc_parser<
+            NextParser, _pchc_counters<Tag, sizeof...(R)>,
+            _pchc_alt<_order.index[Idx], typename _pchc_nth<_order.index[Idx], R...>::type>...>;
+#else
+        using type = _chc_parser<NextParser, typename _pchc_nth<_order.index[Idx], R...>::type...>;
+#endif
+    };
+
+    template <typename NextParser>
+    using parser =
+        typename _parser<NextParser, lexy::_detail::make_index_sequence<sizeof...(R)>>::type;
+};
+
+/// A choice whose alternatives are tried in the order of `lexy::choice_profile<Tag>`, as far as
+/// that doesn't change what it matches.
+template <typename Tag, typename... R>
+LEXY_CONSTEVAL auto profiled_choice(_chc<R...>)
+{
+    return _pchc<Tag, R...>{};
+}
+} // namespace lexyd
+
+#endif // LEXY_DSL_PROFILED_CHOICE_HPP_INCLUDED
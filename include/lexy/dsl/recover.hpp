@@ -108,6 +108,9 @@ struct _reco : rule_base
         {
             while (true)
             {
+                if (!lexy::_check_budget(context, reader))
+                    return false;
+
                 // Try to match the recovery rules.
                 using recovery = lexy::rule_parser<_chc<R...>, NextParser>;
                 auto result    = recovery::try_parse(context, reader, LEXY_FWD(args)...);
@@ -169,6 +172,9 @@ struct _tryr : rule_base
             if (lexy::rule_parser<Rule, NextParser>::parse(context, reader, LEXY_FWD(args)...))
                 // The rule was parsed succesfully, we're done here.
                 return true;
+            else if (!lexy::_check_budget(context, reader))
+                // The handler doesn't want us to recover.
+                return false;
             else
             {
                 if constexpr (std::is_void_v<Recover>)
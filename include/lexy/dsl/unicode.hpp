@@ -0,0 +1,218 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_DSL_UNICODE_HPP_INCLUDED
+#define LEXY_DSL_UNICODE_HPP_INCLUDED
+
+#include <lexy/_detail/unicode_database.hpp>
+#include <lexy/dsl/base.hpp>
+#include <lexy/dsl/code_point.hpp>
+
+namespace lexyd::unicode
+{
+// Derived provides a static `_match(cp, properties)`,
+// where `properties` is the byte of the code point in the database.
+template <typename Derived>
+struct _ucd_predicate
+{
+    constexpr bool operator()(lexy::code_point cp) const
+    {
+        auto value = cp.value();
+        return Derived::_match(value, lexy::_detail::unicode_database_lookup(value));
+    }
+
+    static constexpr bool _match_ascii(char32_t c)
+    {
+        return Derived::_match(c, lexy::_detail::unicode_database_ascii[c]);
+    }
+};
+
+template <lexy::unicode_category... Categories>
+constexpr bool _ucd_is_category(std::uint_least8_t properties)
+{
+    auto category = properties & lexy::_detail::unicode_database_category;
+    return ((category == int(Categories)) || ...);
+}
+
+//=== general category ===//
+template <lexy::unicode_category... Categories>
+struct _category : _ucd_predicate<_category<Categories...>>
+{
+    static LEXY_CONSTEVAL auto name()
+    {
+        return "Unicode.category";
+    }
+
+    static constexpr bool _match(char32_t, std::uint_least8_t properties)
+    {
+        return _ucd_is_category<Categories...>(properties);
+    }
+};
+
+/// Matches a code point in one of the general categories.
+template <lexy::unicode_category... Categories>
+constexpr auto category = _cp<_category<Categories...>>{};
+
+struct _control : _ucd_predicate<_control>
+{
+    static LEXY_CONSTEVAL auto name()
+    {
+        return "Unicode.control";
+    }
+
+    static constexpr bool _match(char32_t, std::uint_least8_t properties)
+    {
+        return _ucd_is_category<lexy::unicode_category::Cc>(properties);
+    }
+};
+inline constexpr auto control = _cp<_control>{};
+
+struct _upper : _ucd_predicate<_upper>
+{
+    static LEXY_CONSTEVAL auto name()
+    {
+        return "Unicode.upper";
+    }
+
+    static constexpr bool _match(char32_t, std::uint_least8_t properties)
+    {
+        return _ucd_is_category<lexy::unicode_category::Lu>(properties);
+    }
+};
+inline constexpr auto upper = _cp<_upper>{};
+
+struct _lower : _ucd_predicate<_lower>
+{
+    static LEXY_CONSTEVAL auto name()
+    {
+        return "Unicode.lower";
+    }
+
+    static constexpr bool _match(char32_t, std::uint_least8_t properties)
+    {
+        return _ucd_is_category<lexy::unicode_category::Ll>(properties);
+    }
+};
+inline constexpr auto lower = _cp<_lower>{};
+
+struct _alpha : _ucd_predicate<_alpha>
+{
+    static LEXY_CONSTEVAL auto name()
+    {
+        return "Unicode.alpha";
+    }
+
+    static constexpr bool _match(char32_t, std::uint_least8_t properties)
+    {
+        using cat = lexy::unicode_category;
+        return _ucd_is_category<cat::Lu, cat::Ll, cat::Lt, cat::Lm, cat::Lo>(properties);
+    }
+};
+inline constexpr auto alpha = _cp<_alpha>{};
+
+struct _digit : _ucd_predicate<_digit>
+{
+    static LEXY_CONSTEVAL auto name()
+    {
+        return "Unicode.digit";
+    }
+
+    static constexpr bool _match(char32_t, std::uint_least8_t properties)
+    {
+        return _ucd_is_category<lexy::unicode_category::Nd>(properties);
+    }
+};
+inline constexpr auto digit = _cp<_digit>{};
+
+struct _alnum : _ucd_predicate<_alnum>
+{
+    static LEXY_CONSTEVAL auto name()
+    {
+        return "Unicode.alnum";
+    }
+
+    static constexpr bool _match(char32_t, std::uint_least8_t properties)
+    {
+        using cat = lexy::unicode_category;
+        return _ucd_is_category<cat::Lu, cat::Ll, cat::Lt, cat::Lm, cat::Lo, cat::Nd>(properties);
+    }
+};
+inline constexpr auto alnum = _cp<_alnum>{};
+
+struct _punct : _ucd_predicate<_punct>
+{
+    static LEXY_CONSTEVAL auto name()
+    {
+        return "Unicode.punct";
+    }
+
+    static constexpr bool _match(char32_t, std::uint_least8_t properties)
+    {
+        using cat = lexy::unicode_category;
+        return _ucd_is_category<cat::Pc, cat::Pd, cat::Ps, cat::Pe, cat::Pi, cat::Pf, cat::Po>(
+            properties);
+    }
+};
+inline constexpr auto punct = _cp<_punct>{};
+
+//=== binary properties ===//
+struct _space : _ucd_predicate<_space>
+{
+    static LEXY_CONSTEVAL auto name()
+    {
+        return "Unicode.space";
+    }
+
+    static constexpr bool _match(char32_t, std::uint_least8_t properties)
+    {
+        return (properties & lexy::_detail::unicode_database_white_space) != 0;
+    }
+};
+inline constexpr auto space = _cp<_space>{};
+
+struct _xid_start : _ucd_predicate<_xid_start>
+{
+    static LEXY_CONSTEVAL auto name()
+    {
+        return "Unicode.XID-start";
+    }
+
+    static constexpr bool _match(char32_t, std::uint_least8_t properties)
+    {
+        return (properties & lexy::_detail::unicode_database_xid_start) != 0;
+    }
+};
+inline constexpr auto xid_start = _cp<_xid_start>{};
+
+struct _xid_start_underscore : _ucd_predicate<_xid_start_underscore>
+{
+    static LEXY_CONSTEVAL auto name()
+    {
+        return "Unicode.XID-start-underscore";
+    }
+
+    static constexpr bool _match(char32_t cp, std::uint_least8_t properties)
+    {
+        return (properties & lexy::_detail::unicode_database_xid_start) != 0 || cp == U'_';
+    }
+};
+inline constexpr auto xid_start_underscore = _cp<_xid_start_underscore>{};
+
+struct _xid_continue : _ucd_predicate<_xid_continue>
+{
+    static LEXY_CONSTEVAL auto name()
+    {
+        return "Unicode.XID-continue";
+    }
+
+    static constexpr bool _match(char32_t, std::uint_least8_t properties)
+    {
+        return (properties & lexy::_detail::unicode_database_xid_continue) != 0;
+    }
+};
+inline constexpr auto xid_continue = _cp<_xid_continue>{};
+} // namespace lexyd::unicode
+
+#endif // LEXY_DSL_UNICODE_HPP_INCLUDED
+
@@ -20,6 +20,9 @@ struct _whl : rule_base
         {
             while (true)
             {
+                if (!lexy::_check_budget(context, reader))
+                    return false;
+
                 using branch_parser
                     = lexy::rule_parser<Branch, lexy::context_discard_parser<Context>>;
 
@@ -81,6 +84,9 @@ struct _whlt : rule_base
         {
             while (true)
             {
+                if (!lexy::_check_budget(context, reader))
+                    return false;
+
                 using term_parser = lexy::rule_parser<Term, NextParser>;
                 if (auto result = term_parser::try_parse(context, reader, LEXY_FWD(args)...);
                     result != lexy::rule_try_parse_result::backtracked)
@@ -7,6 +7,7 @@
 
 #include <lexy/_detail/assert.hpp>
 #include <lexy/_detail/config.hpp>
+#include <lexy/_detail/detect.hpp>
 #include <lexy/input/base.hpp>
 
 #if 0
@@ -28,6 +29,11 @@ struct Matcher : engine_matcher_base
     /// If not possible, keeps input at the error position and returns false.
     template <typename Reader>
     static bool recover(Reader& reader, error_code ec);
+
+    /// Returns false if the engine can't match input starting with `c` (optional).
+    /// It is used to quickly skip over input when searching for a match.
+    template <typename Encoding>
+    static bool can_start_with(typename Encoding::int_type c);
 };
 
 /// Parses something, i.e. consumes and input and returns a result or error.
@@ -75,6 +81,15 @@ constexpr bool engine_is_matcher = std::is_base_of_v<engine_matcher_base, Engine
 template <typename Engine>
 constexpr bool engine_is_parser = std::is_base_of_v<engine_parser_base, Engine>;
 
+template <typename Engine, typename Encoding>
+using _detect_engine_can_start_with
+    = decltype(Engine::template can_start_with<Encoding>(typename Encoding::int_type()));
+
+/// Whether or not the engine can tell which characters can start a match.
+template <typename Engine, typename Encoding>
+constexpr bool engine_has_start_filter
+    = _detail::is_detected<_detect_engine_can_start_with, Engine, Encoding>;
+
 /// Whether or not the engine can fail on the given input.
 template <typename Engine, typename Reader>
 constexpr bool engine_can_fail = true;
@@ -5,6 +5,7 @@
 #ifndef LEXY_ENGINE_CODE_POINT_HPP_INCLUDED
 #define LEXY_ENGINE_CODE_POINT_HPP_INCLUDED
 
+#include <cstdint>
 #include <lexy/_detail/detect.hpp>
 #include <lexy/engine/base.hpp>
 
@@ -459,5 +460,157 @@ struct engine_cp_auto : lexy::engine_matcher_base, lexy::engine_parser_base
 };
 } // namespace lexy
 
+namespace lexy::_detail
+{
+// A predicate can provide a static `_match_ascii(c)` that checks an ASCII code point,
+// which is used to skip decoding.
+template <typename Predicate>
+using _detect_cp_ascii_fast_path = decltype(Predicate::_match_ascii(char32_t()));
+template <typename Predicate>
+constexpr bool cp_has_ascii_fast_path = is_detected<_detect_cp_ascii_fast_path, Predicate>;
+
+// A reader can provide `_sentinel()` and `_set_cur()` to process a run of code units at once.
+template <typename Reader>
+using _detect_cp_run_reader
+    = decltype(LEXY_DECLVAL(Reader&)._set_cur(LEXY_DECLVAL(Reader&)._sentinel()));
+template <typename Reader>
+constexpr bool cp_is_run_reader = is_detected<_detect_cp_run_reader, Reader> //
+                                  && std::is_pointer_v<typename Reader::iterator>;
+
+template <typename CharT>
+constexpr std::uint_least32_t cp_code_unit(CharT c)
+{
+    if constexpr (sizeof(CharT) == 1)
+        return static_cast<unsigned char>(c);
+    else
+        return static_cast<std::uint_least32_t>(c);
+}
+
+// Whether a code unit is an ASCII code point that matches the predicate,
+// so runs can be checked without calling the predicate or branching on each code unit.
+template <typename Predicate>
+struct cp_ascii_table
+{
+    unsigned char matches[256] = {};
+
+    constexpr cp_ascii_table()
+    {
+        for (auto c = 0u; c != 0x80; ++c)
+            matches[c] = Predicate::_match_ascii(char32_t(c)) ? 1 : 0;
+    }
+};
+template <typename Predicate>
+constexpr auto cp_ascii_table_v = cp_ascii_table<Predicate>();
+
+// Returns the end of the run of ASCII code points in [cur, end) that match the predicate.
+template <typename Predicate, typename CharT>
+constexpr const CharT* cp_ascii_run(const CharT* cur, const CharT* end)
+{
+    constexpr auto& table = cp_ascii_table_v<Predicate>.matches;
+    if constexpr (sizeof(CharT) == 1)
+    {
+        // Check eight code units with a single branch; the scalar loop below finds the one that
+        // doesn't match.
+        while (end - cur >= 8)
+        {
+            auto all = table[cp_code_unit(cur[0])] & table[cp_code_unit(cur[1])]
+                       & table[cp_code_unit(cur[2])] & table[cp_code_unit(cur[3])]
+                       & table[cp_code_unit(cur[4])] & table[cp_code_unit(cur[5])]
+                       & table[cp_code_unit(cur[6])] & table[cp_code_unit(cur[7])];
+            if (all == 0)
+                break;
+
+            cur += 8;
+        }
+    }
+
+    while (cur != end)
+    {
+        auto c = cp_code_unit(*cur);
+        if (c > 0xFF || table[c] == 0)
+            break;
+        ++cur;
+    }
+    return cur;
+}
+} // namespace lexy::_detail
+
+namespace lexy
+{
+/// Matches code points that satisfy the predicate as often as possible.
+/// If the predicate has an ASCII fast path, runs of ASCII code points are matched without
+/// decoding them by looking up each code unit in a table; when reading bytes from memory,
+/// eight of them are checked with a single branch.
+template <typename Predicate>
+struct engine_cp_while : engine_matcher_base
+{
+    enum class error_code
+    {
+    };
+
+    // Matches a run of ASCII code points, returns true if a non-ASCII one follows.
+    template <typename Reader>
+    static constexpr bool _match_ascii_run(Reader& reader)
+    {
+        if constexpr (lexy::_detail::cp_is_run_reader<Reader>)
+        {
+            auto end = lexy::_detail::cp_ascii_run<Predicate>(reader.cur(), reader._sentinel());
+            reader._set_cur(end);
+        }
+        else
+        {
+            while (true)
+            {
+                auto c = static_cast<std::uint_least32_t>(reader.peek());
+                if (c > 0x7F || !Predicate::_match_ascii(char32_t(c)))
+                    break;
+                reader.bump();
+            }
+        }
+
+        // At EOF, decoding the code point fails and ends the loop.
+        auto c = static_cast<std::uint_least32_t>(reader.peek());
+        return c > 0x7F;
+    }
+
+    template <typename Reader>
+    static constexpr error_code match(Reader& reader)
+    {
+        while (true)
+        {
+            if constexpr (lexy::_detail::cp_has_ascii_fast_path<Predicate>)
+            {
+                if (!_match_ascii_run(reader))
+                    break;
+            }
+
+            auto save = reader;
+
+            engine_cp_auto::error_code ec{};
+            [[maybe_unused]] auto      cp = engine_cp_auto::parse(ec, reader);
+            if (ec != engine_cp_auto::error_code())
+            {
+                reader = LEXY_MOV(save);
+                break;
+            }
+
+            if constexpr (!std::is_void_v<Predicate>)
+            {
+                if (!Predicate()(cp))
+                {
+                    reader = LEXY_MOV(save);
+                    break;
+                }
+            }
+        }
+
+        return error_code();
+    }
+};
+
+template <typename Predicate, typename Reader>
+inline constexpr bool engine_can_fail<engine_cp_while<Predicate>, Reader> = false;
+} // namespace lexy
+
 #endif // LEXY_ENGINE_CODE_POINT_HPP_INCLUDED
 
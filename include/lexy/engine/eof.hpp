@@ -22,6 +22,13 @@ struct engine_eof : engine_matcher_base
     {
         return reader.eof() ? error_code() : error_code::error;
     }
+
+    template <typename Encoding>
+    static constexpr bool can_start_with(typename Encoding::int_type c)
+    {
+        // Some encodings use a valid character as EOF, so it's only a candidate.
+        return c == Encoding::eof();
+    }
 };
 } // namespace lexy
 
@@ -9,6 +9,27 @@
 
 namespace lexy
 {
+// Skips characters that can't start a match of any of the engines, if they all know them.
+// This is a lot cheaper than trying to match them at every position.
+template <typename... Engines, typename Reader>
+constexpr void _find_skip(Reader& reader)
+{
+    using encoding = typename Reader::encoding;
+    if constexpr ((engine_has_start_filter<Engines, encoding> && ...))
+    {
+        while (true)
+        {
+            auto c = reader.peek();
+            if ((Engines::template can_start_with<encoding>(c) || ...))
+                break;
+            else if (c == encoding::eof() && reader.eof())
+                break;
+
+            reader.bump();
+        }
+    }
+}
+
 /// Matches everything until and excluding Condition.
 template <typename Condition>
 struct engine_find : engine_matcher_base
@@ -23,12 +44,14 @@ struct engine_find : engine_matcher_base
     template <typename Reader>
     static constexpr error_code match(Reader& reader)
     {
+        _find_skip<Condition>(reader);
         while (!engine_peek<Condition>(reader))
         {
             if (reader.eof())
                 return error_code::not_found;
-            else
-                reader.bump();
+
+            reader.bump();
+            _find_skip<Condition>(reader);
         }
 
         return error_code();
@@ -51,14 +74,16 @@ struct engine_find_before : engine_matcher_base
     template <typename Reader>
     static constexpr error_code match(Reader& reader)
     {
+        _find_skip<Condition, Limit>(reader);
         while (!engine_peek<Condition>(reader))
         {
             if (reader.eof())
                 return error_code::not_found_eof;
             else if (engine_peek<Limit>(reader))
                 return error_code::not_found_limit;
-            else
-                reader.bump();
+
+            reader.bump();
+            _find_skip<Condition, Limit>(reader);
         }
 
         return error_code();
@@ -86,6 +86,15 @@ struct engine_literal : engine_matcher_base
     {
         return _transition(reader, LTrie.node_sequence());
     }
+
+    template <typename Encoding>
+    static constexpr bool can_start_with(typename Encoding::int_type c)
+    {
+        if constexpr (LTrie.empty())
+            return true;
+        else
+            return c == LTrie.template transition<Encoding>(0);
+    }
 };
 
 template <const auto& LTrie, typename Reader>
@@ -210,6 +210,47 @@ struct engine_trie : engine_matcher_base, engine_parser_base
         }
     };
 
+    // A table of the characters that can start a string, for single byte encodings.
+    template <typename Encoding>
+    struct _first_char_table
+    {
+        bool value[256];
+    };
+    template <typename Encoding>
+    static LEXY_CONSTEVAL auto _make_first_char_table()
+    {
+        _first_char_table<Encoding> result{};
+        for (auto transition = 0u; transition != Trie.transition_count(0); ++transition)
+        {
+            auto c = _char_to_int_type<Encoding>(Trie.transition_char(0, transition));
+            result.value[static_cast<unsigned char>(c)] = true;
+        }
+        return result;
+    }
+    template <typename Encoding>
+    static constexpr auto _first_chars = _make_first_char_table<Encoding>();
+
+    template <typename Encoding, std::size_t... Transitions>
+    static constexpr bool _is_first_char(typename Encoding::int_type c,
+                                         lexy::_detail::index_sequence<Transitions...>)
+    {
+        return ((c == _char_to_int_type<Encoding>(Trie.transition_char(0, Transitions))) || ...);
+    }
+
+    template <typename Encoding>
+    static constexpr bool can_start_with(typename Encoding::int_type c)
+    {
+        if constexpr (Trie.accepts_empty())
+            return true;
+        else if constexpr (sizeof(typename Encoding::char_type) == 1
+                           && std::is_integral_v<typename Encoding::int_type>)
+            // The cast maps EOF to some other character, but that's fine: we only need to reject
+            // characters that definitely can't start a match.
+            return _first_chars<Encoding>.value[static_cast<unsigned char>(c)];
+        else
+            return _is_first_char<Encoding>(c, _transition_sequence<0>{});
+    }
+
     template <typename Reader>
     static constexpr error_code match(Reader& reader)
     {
@@ -5,10 +5,15 @@
 #ifndef LEXY_ENGINE_WHILE_HPP_INCLUDED
 #define LEXY_ENGINE_WHILE_HPP_INCLUDED
 
+#include <lexy/_detail/detect.hpp>
 #include <lexy/engine/base.hpp>
 
 namespace lexy
 {
+// A matcher can provide a `while_engine` that matches it as often as possible more efficiently.
+template <typename Matcher>
+using _detect_while_engine = typename Matcher::while_engine;
+
 /// Matches `Matcher` as often as possible.
 template <typename Matcher>
 struct engine_while : engine_matcher_base
@@ -22,8 +27,15 @@ struct engine_while : engine_matcher_base
     template <typename Reader>
     static constexpr error_code match(Reader& reader)
     {
-        while (engine_try_match<Matcher>(reader))
-        {}
+        if constexpr (lexy::_detail::is_detected<_detect_while_engine, Matcher>)
+        {
+            Matcher::while_engine::match(reader);
+        }
+        else
+        {
+            while (engine_try_match<Matcher>(reader))
+            {}
+        }
 
         return error_code();
     }
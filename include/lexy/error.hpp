@@ -5,6 +5,8 @@
 #ifndef LEXY_ERROR_HPP_INCLUDED
 #define LEXY_ERROR_HPP_INCLUDED
 
+#include <cstdint>
+#include <lexy/_detail/assert.hpp>
 #include <lexy/_detail/config.hpp>
 #include <lexy/input/base.hpp>
 #include <lexy/production.hpp>
@@ -206,5 +208,157 @@ private:
 };
 } // namespace lexy
 
+namespace lexy::_detail
+{
+// Its address uniquely identifies the type.
+template <typename T>
+inline constexpr char type_id = 0;
+
+struct compact_error_kind
+{
+    const void* tag_id;
+    const char* tag_name;
+    const void* production_id;
+    const char* production_name;
+};
+
+template <typename Production, typename Tag>
+inline constexpr compact_error_kind compact_error_kind_for
+    = {&type_id<Tag>, type_name<Tag>(), &type_id<Production>, production_name<Production>()};
+} // namespace lexy::_detail
+
+namespace lexy
+{
+/// A type-erased error together with its context that stores only offsets into the input.
+/// It is cheap to create and store; the actual `lexy::error` and `lexy::error_context` objects
+/// are only created on demand.
+template <typename Input>
+class compact_error
+{
+    using _reader_t  = input_reader<Input>;
+    using _iterator  = typename _reader_t::iterator;
+    using _char_type = typename _reader_t::char_type;
+
+public:
+    template <typename Production, typename Reader, typename Tag>
+    constexpr explicit compact_error(const error_context<Production, Input>& context,
+                                     const error<Reader, Tag>&                error) noexcept
+    : _production_offset(), _offset(), _length(0), _index(0),
+      _kind(&_detail::compact_error_kind_for<Production, Tag>), _data(nullptr)
+    {
+        auto begin         = context.input().reader().cur();
+        _production_offset = _to_offset(begin, context.position());
+        _offset            = _to_offset(begin, error.position());
+
+        if constexpr (std::is_same_v<Tag, expected_literal>)
+        {
+            LEXY_PRECONDITION(error.index() <= UINT32_MAX);
+            _index = static_cast<std::uint32_t>(error.index());
+            _data  = error.string();
+        }
+        else if constexpr (std::is_same_v<Tag, expected_keyword>)
+        {
+            _length = _to_offset(error.begin(), error.end());
+            _data   = error.string();
+        }
+        else if constexpr (std::is_same_v<Tag, expected_char_class>)
+        {
+            _data = error.character_class();
+        }
+        else
+        {
+            _length = _to_offset(error.begin(), error.end());
+        }
+    }
+
+    //=== type-erased access ===//
+    /// The offset of the error position from the beginning of the input.
+    constexpr std::uint32_t offset() const noexcept
+    {
+        return _offset;
+    }
+    /// The number of code units covered by the error; zero unless it has a range.
+    constexpr std::uint32_t length() const noexcept
+    {
+        return _length;
+    }
+    /// The offset of the starting position of the production from the beginning of the input.
+    constexpr std::uint32_t production_offset() const noexcept
+    {
+        return _production_offset;
+    }
+
+    /// Whether the error has the given tag.
+    template <typename Tag>
+    constexpr bool is() const noexcept
+    {
+        return _kind->tag_id == &_detail::type_id<Tag>;
+    }
+    /// Whether the error occurred in the given production.
+    template <typename Production>
+    constexpr bool is_in() const noexcept
+    {
+        return _kind->production_id == &_detail::type_id<Production>;
+    }
+
+    /// The name of the tag, i.e. the message of the generic `lexy::error`.
+    constexpr const char* message() const noexcept
+    {
+        return _kind->tag_name;
+    }
+    /// The name of the production where the error occurred.
+    constexpr const char* production() const noexcept
+    {
+        return _kind->production_name;
+    }
+
+    //=== materialization ===//
+    /// Re-creates the original error; requires `is<Tag>()`.
+    template <typename Tag>
+    constexpr auto materialize_error(const Input& input) const noexcept -> error_for<Input, Tag>
+    {
+        LEXY_PRECONDITION(is<Tag>());
+
+        auto pos = _detail::next(input.reader().cur(), _offset);
+        if constexpr (std::is_same_v<Tag, expected_literal>)
+            return error_for<Input, Tag>(pos, static_cast<const _char_type*>(_data), _index);
+        else if constexpr (std::is_same_v<Tag, expected_keyword>)
+            return error_for<Input, Tag>(pos, _detail::next(pos, _length),
+                                         static_cast<const _char_type*>(_data));
+        else if constexpr (std::is_same_v<Tag, expected_char_class>)
+            return error_for<Input, Tag>(pos, static_cast<const char*>(_data));
+        else
+            return error_for<Input, Tag>(pos, _detail::next(pos, _length));
+    }
+
+    /// Re-creates the original error context; requires `is_in<Production>()`.
+    template <typename Production>
+    constexpr auto materialize_context(const Input& input) const noexcept
+        -> error_context<Production, Input>
+    {
+        LEXY_PRECONDITION(is_in<Production>());
+
+        auto pos = _detail::next(input.reader().cur(), _production_offset);
+        return error_context<Production, Input>(input, pos);
+    }
+
+private:
+    template <typename I>
+    static constexpr std::uint32_t _to_offset(I begin, I end) noexcept
+    {
+        auto result = _detail::range_size(begin, end);
+        LEXY_PRECONDITION(result <= UINT32_MAX);
+        return static_cast<std::uint32_t>(result);
+    }
+
+    std::uint32_t                     _production_offset;
+    std::uint32_t                     _offset;
+    std::uint32_t                     _length;
+    std::uint32_t                     _index;
+    const _detail::compact_error_kind* _kind;
+    const void*                       _data;
+};
+} // namespace lexy
+
 #endif // LEXY_ERROR_HPP_INCLUDED
 
@@ -0,0 +1,178 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_HUGE_PAGE_RESOURCE_HPP_INCLUDED
+#define LEXY_HUGE_PAGE_RESOURCE_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <lexy/_detail/assert.hpp>
+#include <lexy/_detail/config.hpp>
+#include <new>
+
+namespace lexy::_detail
+{
+constexpr std::size_t huge_page_size = std::size_t(2) * 1024 * 1024;
+
+// Maps `size` bytes, a multiple of `huge_page_size`, aligned to `huge_page_size`.
+// It asks the OS to back the memory with huge pages, and sets `is_huge` if it agreed.
+// Returns nullptr if no memory could be mapped at all.
+//
+// Do not change ABI, especially with different build configurations!
+void* map_huge_pages(std::size_t size, bool& is_huge) noexcept;
+void  unmap_huge_pages(void* memory, std::size_t size) noexcept;
+} // namespace lexy::_detail
+
+namespace lexy
+{
+/// A memory resource that allocates from large regions that are backed by huge pages where
+/// possible, which reduces TLB misses when working with big parse trees or buffers.
+///
+/// Small allocations are only released when the resource is destroyed or `release()` is called,
+/// allocations bigger than half a region get a mapping of their own.
+class huge_page_resource
+{
+public:
+    /// `lexy::parse_tree` uses blocks of that size instead of 4 KiB.
+    static constexpr std::size_t block_size = 64 * 1024;
+
+    explicit huge_page_resource(std::size_t region_size = 16 * _detail::huge_page_size) noexcept
+    : _regions(nullptr), _cur(nullptr), _end(nullptr),
+      _region_size(_round_up(region_size, _detail::huge_page_size)), _mapped_bytes(0),
+      _huge_bytes(0)
+    {}
+
+    huge_page_resource(const huge_page_resource&) = delete;
+    huge_page_resource& operator=(const huge_page_resource&) = delete;
+
+    ~huge_page_resource() noexcept
+    {
+        release();
+    }
+
+    //=== memory resource ===//
+    void* allocate(std::size_t bytes, std::size_t alignment)
+    {
+        LEXY_PRECONDITION(alignment <= _detail::huge_page_size);
+
+        if (bytes > _region_size / 2)
+        {
+            // The header is stored in front of the allocation.
+            auto offset = _round_up(sizeof(_region), alignment);
+            auto region = _map(_round_up(offset + bytes, _detail::huge_page_size));
+            return reinterpret_cast<unsigned char*>(region) + offset;
+        }
+
+        auto memory = _cur == nullptr ? nullptr : _align(_cur, alignment);
+        if (memory == nullptr || std::size_t(_end - memory) < bytes)
+        {
+            auto region = _map(_region_size);
+            _cur        = reinterpret_cast<unsigned char*>(region + 1);
+            _end        = reinterpret_cast<unsigned char*>(region) + _region_size;
+            memory      = _align(_cur, alignment);
+        }
+
+        _cur = memory + bytes;
+        return memory;
+    }
+
+    void deallocate(void* ptr, std::size_t bytes, std::size_t alignment) noexcept
+    {
+        if (bytes <= _region_size / 2)
+            // Released together with the region.
+            return;
+
+        auto offset = _round_up(sizeof(_region), alignment);
+        auto region = reinterpret_cast<_region*>(static_cast<unsigned char*>(ptr) - offset);
+        _unmap(region);
+    }
+
+    friend bool operator==(const huge_page_resource& lhs, const huge_page_resource& rhs) noexcept
+    {
+        return &lhs == &rhs;
+    }
+
+    //=== management ===//
+    /// Releases all memory, including memory that hasn't been deallocated yet.
+    void release() noexcept
+    {
+        while (_regions != nullptr)
+            _unmap(_regions);
+        _cur = _end = nullptr;
+    }
+
+    /// The number of bytes that are currently mapped.
+    std::size_t mapped_bytes() const noexcept
+    {
+        return _mapped_bytes;
+    }
+    /// The number of mapped bytes the OS agreed to back with huge pages.
+    std::size_t huge_page_bytes() const noexcept
+    {
+        return _huge_bytes;
+    }
+
+private:
+    struct _region
+    {
+        _region*    prev;
+        _region*    next;
+        std::size_t size;
+        bool        is_huge;
+    };
+
+    static constexpr std::size_t _round_up(std::size_t size, std::size_t alignment) noexcept
+    {
+        return (size + alignment - 1) / alignment * alignment;
+    }
+    unsigned char* _align(unsigned char* ptr, std::size_t alignment) const noexcept
+    {
+        auto address = reinterpret_cast<std::uintptr_t>(ptr);
+        auto result  = ptr + (_round_up(address, alignment) - address);
+        return result <= _end ? result : nullptr;
+    }
+
+    _region* _map(std::size_t size)
+    {
+        auto is_huge = false;
+        auto memory  = _detail::map_huge_pages(size, is_huge);
+        if (memory == nullptr)
+            throw std::bad_alloc();
+
+        auto region = ::new (memory) _region{nullptr, _regions, size, is_huge};
+        if (_regions != nullptr)
+            _regions->prev = region;
+        _regions = region;
+
+        _mapped_bytes += size;
+        if (is_huge)
+            _huge_bytes += size;
+        return region;
+    }
+
+    void _unmap(_region* region) noexcept
+    {
+        if (region->prev != nullptr)
+            region->prev->next = region->next;
+        else
+            _regions = region->next;
+        if (region->next != nullptr)
+            region->next->prev = region->prev;
+
+        _mapped_bytes -= region->size;
+        if (region->is_huge)
+            _huge_bytes -= region->size;
+        _detail::unmap_huge_pages(region, region->size);
+    }
+
+    _region*       _regions;
+    unsigned char* _cur;
+    unsigned char* _end;
+    std::size_t    _region_size;
+    std::size_t    _mapped_bytes, _huge_bytes;
+};
+} // namespace lexy
+
+#endif // LEXY_HUGE_PAGE_RESOURCE_HPP_INCLUDED
+
@@ -79,6 +79,9 @@ private:
 
     friend constexpr argv_iterator argv_begin(int argc, char* argv[]) noexcept;
     friend constexpr argv_iterator argv_end(int argc, char* argv[]) noexcept;
+
+    template <typename Encoding>
+    friend class _argv_reader;
 };
 
 /// Returns an iterator to the beginning of the command-line arguments.
@@ -111,6 +114,75 @@ constexpr argv_iterator argv_end(int argc, char* argv[]) noexcept
 
 namespace lexy
 {
+// Reads each argument as a contiguous segment that ends at its null terminator.
+// Inside a segment, it only compares the pointer with the end of the segment;
+// it only looks at argv itself when it bumps past the end of a segment.
+template <typename Encoding>
+class _argv_reader
+{
+public:
+    using encoding         = Encoding;
+    using char_type        = typename encoding::char_type;
+    using iterator         = argv_iterator;
+    using canonical_reader = _argv_reader<Encoding>;
+
+    constexpr explicit _argv_reader(argv_iterator begin, argv_iterator end) noexcept
+    : _arg(begin._arg), _c(begin._c), _segment_end(nullptr), _end(end._c)
+    {
+        _segment_end = _find_segment_end();
+    }
+
+    constexpr bool eof() const noexcept
+    {
+        // Every character of argv has a distinct address, so comparing the pointer is enough.
+        return _c == _end;
+    }
+
+    constexpr auto peek() const noexcept
+    {
+        if (_c != _segment_end)
+            return encoding::to_int_type(static_cast<char_type>(*_c));
+        else if (_c == _end)
+            return encoding::eof();
+        else
+            // We're at the null terminator that separates two arguments.
+            return encoding::to_int_type(static_cast<char_type>('\0'));
+    }
+
+    constexpr void bump() noexcept
+    {
+        LEXY_PRECONDITION(_c != _end);
+        if (_c != _segment_end)
+            ++_c;
+        else
+        {
+            // Go to the next argument.
+            ++_arg;
+            _c           = *_arg;
+            _segment_end = _find_segment_end();
+        }
+    }
+
+    constexpr iterator cur() const noexcept
+    {
+        return argv_iterator(_arg, _c);
+    }
+
+private:
+    constexpr const char* _find_segment_end() const noexcept
+    {
+        const char* result = _c;
+        while (result != _end && *result != '\0')
+            ++result;
+        return result;
+    }
+
+    char**      _arg;
+    char*       _c;
+    const char* _segment_end;
+    const char* _end;
+};
+
 template <typename Encoding = default_encoding>
 class argv_input
 {
@@ -138,7 +210,7 @@ public:
     //=== reader ===//
     constexpr auto reader() const& noexcept
     {
-        return _detail::range_reader<encoding, iterator>(_begin, _end);
+        return _argv_reader<encoding>(_begin, _end);
     }
 
 private:
@@ -164,9 +236,6 @@ namespace lexyd
 {
 struct _argvsep : token_base<_argvsep>
 {
-    template <typename Encoding>
-    using _argv_reader = lexy::_detail::range_reader<Encoding, lexy::argv_iterator>;
-
     struct token_engine : lexy::engine_matcher_base
     {
         enum class error_code
@@ -175,7 +244,7 @@ struct _argvsep : token_base<_argvsep>
         };
 
         template <typename Encoding>
-        static constexpr error_code match(_argv_reader<Encoding>& reader)
+        static constexpr error_code match(lexy::_argv_reader<Encoding>& reader)
         {
             if (reader.peek() != lexy::_char_to_int_type<Encoding>('\0'))
                 return error_code::error;
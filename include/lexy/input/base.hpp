@@ -6,6 +6,7 @@
 #define LEXY_INPUT_BASE_HPP_INCLUDED
 
 #include <lexy/_detail/config.hpp>
+#include <lexy/_detail/detect.hpp>
 #include <lexy/encoding.hpp>
 
 #if 0
@@ -70,6 +71,22 @@ constexpr auto range_size(I begin, I2 end)
     return result;
 }
 
+template <typename I>
+using _detect_random_access = decltype(I(LEXY_DECLVAL(I) + std::size_t(0)));
+
+template <typename I>
+constexpr I next(I iter, std::size_t n)
+{
+    if constexpr (_detail::is_detected<_detect_random_access, I>)
+        return iter + n;
+    else
+    {
+        for (auto i = std::size_t(0); i != n; ++i)
+            ++iter;
+        return iter;
+    }
+}
+
 template <typename Encoding, typename Iterator, typename Sentinel = Iterator>
 class range_reader
 {
@@ -111,10 +128,64 @@ public:
         _cur = _end;
     }
 
+    // Used by engines that process a run of code units at once.
+    constexpr Sentinel _sentinel() const noexcept
+    {
+        return _end;
+    }
+    constexpr void _set_cur(Iterator cur) noexcept
+    {
+        _cur = cur;
+    }
+
 private:
     Iterator                   _cur;
     LEXY_EMPTY_MEMBER Sentinel _end;
 };
+
+// Whether the encoding has a spare code point that can be used as an EOF sentinel.
+template <typename Encoding>
+constexpr bool has_eof_sentinel
+    = std::is_same_v<typename Encoding::char_type, typename Encoding::int_type>;
+
+// Reads until it reaches the EOF sentinel, which must be stored after the input.
+template <typename Encoding>
+class sentinel_reader
+{
+    static_assert(has_eof_sentinel<Encoding>);
+
+public:
+    using encoding         = Encoding;
+    using char_type        = typename encoding::char_type;
+    using iterator         = const char_type*;
+    using canonical_reader = sentinel_reader<Encoding>;
+
+    constexpr explicit sentinel_reader(iterator begin) noexcept : _cur(begin) {}
+
+    constexpr bool eof() const noexcept
+    {
+        return *_cur == encoding::eof();
+    }
+
+    constexpr auto peek() const noexcept
+    {
+        // The last one will be EOF.
+        return *_cur;
+    }
+
+    constexpr void bump() noexcept
+    {
+        ++_cur;
+    }
+
+    constexpr iterator cur() const noexcept
+    {
+        return _cur;
+    }
+
+private:
+    iterator _cur;
+};
 } // namespace lexy::_detail
 
 namespace lexy
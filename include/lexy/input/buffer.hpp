@@ -20,8 +20,7 @@ template <typename Encoding       = default_encoding,
           typename MemoryResource = _detail::default_memory_resource>
 class buffer
 {
-    static constexpr auto _has_sentinel
-        = std::is_same_v<typename Encoding::char_type, typename Encoding::int_type>;
+    static constexpr auto _has_sentinel = _detail::has_eof_sentinel<Encoding>;
 
 public:
     using encoding  = Encoding;
@@ -183,48 +182,12 @@ public:
     auto reader() const& noexcept
     {
         if constexpr (_has_sentinel)
-            return _sentinel_reader(_data);
+            return _detail::sentinel_reader<encoding>(_data);
         else
             return _detail::range_reader<encoding, const char_type*>(_data, _data + _size);
     }
 
 private:
-    class _sentinel_reader
-    {
-    public:
-        using encoding         = Encoding;
-        using char_type        = typename encoding::char_type;
-        using iterator         = const char_type*;
-        using canonical_reader = _sentinel_reader;
-
-        bool eof() const noexcept
-        {
-            return *_cur == encoding::eof();
-        }
-
-        auto peek() const noexcept
-        {
-            // The last one will be EOF.
-            return *_cur;
-        }
-
-        void bump() noexcept
-        {
-            ++_cur;
-        }
-
-        iterator cur() const noexcept
-        {
-            return _cur;
-        }
-
-    private:
-        explicit _sentinel_reader(iterator begin) noexcept : _cur(begin) {}
-
-        iterator _cur;
-        friend buffer;
-    };
-
     char_type* allocate(std::size_t size) const
     {
         if constexpr (_has_sentinel)
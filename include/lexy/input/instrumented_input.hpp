@@ -0,0 +1,209 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_INPUT_INSTRUMENTED_INPUT_HPP_INCLUDED
+#define LEXY_INPUT_INSTRUMENTED_INPUT_HPP_INCLUDED
+
+#include <cstddef>
+#include <vector>
+
+#include <lexy/error.hpp>
+#include <lexy/input/base.hpp>
+#include <lexy/lexeme.hpp>
+
+namespace lexy
+{
+/// The operations done by the reader of a `lexy::instrumented_input`.
+class reader_statistics
+{
+public:
+    /// The number of calls to `peek()` or `eof()`.
+    std::size_t peeks() const noexcept
+    {
+        return _peeks;
+    }
+    /// The number of calls to `bump()`.
+    std::size_t bumps() const noexcept
+    {
+        return _bumps;
+    }
+    /// The number of times the reader was copied, e.g. to try something.
+    std::size_t copies() const noexcept
+    {
+        return _copies;
+    }
+    /// The number of times the reader was assigned, e.g. to backtrack.
+    std::size_t restores() const noexcept
+    {
+        return _restores;
+    }
+
+    /// The number of times the code unit at the position was examined.
+    /// The position one past the last code unit is examined when checking for EOF.
+    std::size_t multiplicity(std::size_t pos) const noexcept
+    {
+        return pos < _multiplicity.size() ? _multiplicity[pos] : 0;
+    }
+    /// One past the last position that was examined.
+    std::size_t positions() const noexcept
+    {
+        return _multiplicity.size();
+    }
+
+    /// The number of examinations beyond the first, summed over all positions.
+    std::size_t rescans() const noexcept
+    {
+        std::size_t result = 0;
+        for (auto m : _multiplicity)
+            if (m > 1)
+                result += m - 1;
+        return result;
+    }
+
+    /// `result[k]` is the number of positions that were examined exactly `k` times,
+    /// the last entry counts all positions that were examined `max` or more times.
+    std::vector<std::size_t> multiplicity_histogram(std::size_t max = 16) const
+    {
+        std::vector<std::size_t> result(max + 1);
+        for (auto m : _multiplicity)
+            ++result[m < max ? m : max];
+        return result;
+    }
+
+    /// `result[i]` is the number of examinations of the positions in
+    /// `[i * region_size, (i + 1) * region_size)`.
+    std::vector<std::size_t> region_multiplicity(std::size_t region_size) const
+    {
+        LEXY_PRECONDITION(region_size > 0);
+
+        std::vector<std::size_t> result((_multiplicity.size() + region_size - 1) / region_size);
+        for (auto pos = std::size_t(0); pos != _multiplicity.size(); ++pos)
+            result[pos / region_size] += _multiplicity[pos];
+        return result;
+    }
+
+    void reset() noexcept
+    {
+        *this = reader_statistics();
+    }
+
+private:
+    void _examine(std::size_t pos)
+    {
+        ++_peeks;
+        if (pos >= _multiplicity.size())
+            _multiplicity.resize(pos + 1);
+        ++_multiplicity[pos];
+    }
+
+    std::size_t              _peeks    = 0;
+    std::size_t              _bumps    = 0;
+    std::size_t              _copies   = 0;
+    std::size_t              _restores = 0;
+    std::vector<std::size_t> _multiplicity;
+
+    template <typename Reader>
+    friend class _instrumented_reader;
+};
+
+template <typename Reader>
+class _instrumented_reader
+{
+public:
+    using encoding         = typename Reader::encoding;
+    using char_type        = typename Reader::char_type;
+    using iterator         = typename Reader::iterator;
+    using canonical_reader = _instrumented_reader<Reader>;
+
+    explicit _instrumented_reader(Reader reader, reader_statistics& stats) noexcept
+    : _reader(reader), _stats(&stats), _pos(0)
+    {}
+
+    _instrumented_reader(const _instrumented_reader& other) noexcept
+    : _reader(other._reader), _stats(other._stats), _pos(other._pos)
+    {
+        ++_stats->_copies;
+    }
+    _instrumented_reader& operator=(const _instrumented_reader& other) noexcept
+    {
+        _reader = other._reader;
+        _stats  = other._stats;
+        _pos    = other._pos;
+        ++_stats->_restores;
+        return *this;
+    }
+
+    bool eof() const
+    {
+        _stats->_examine(_pos);
+        return _reader.eof();
+    }
+
+    auto peek() const
+    {
+        _stats->_examine(_pos);
+        return _reader.peek();
+    }
+
+    void bump() noexcept
+    {
+        ++_stats->_bumps;
+        ++_pos;
+        _reader.bump();
+    }
+
+    iterator cur() const noexcept
+    {
+        return _reader.cur();
+    }
+
+private:
+    Reader             _reader;
+    reader_statistics* _stats;
+    std::size_t        _pos;
+};
+
+/// An input that records what its reader does while parsing another input.
+template <typename Input>
+class instrumented_input
+{
+public:
+    using encoding  = typename Input::encoding;
+    using char_type = typename encoding::char_type;
+
+    explicit instrumented_input(const Input& input) noexcept : _input(&input) {}
+    // The input is only referenced, so it must outlive the instrumented input.
+    instrumented_input(const Input&&) = delete;
+
+    instrumented_input(const instrumented_input&) = delete;
+    instrumented_input& operator=(const instrumented_input&) = delete;
+
+    const reader_statistics& statistics() const noexcept
+    {
+        return _stats;
+    }
+    void reset_statistics() noexcept
+    {
+        _stats.reset();
+    }
+
+    auto reader() const& noexcept
+    {
+        return _instrumented_reader(_input->reader(), _stats);
+    }
+
+private:
+    const Input*              _input;
+    mutable reader_statistics _stats;
+};
+
+template <typename Input>
+using instrumented_lexeme = lexeme_for<instrumented_input<Input>>;
+template <typename Tag, typename Input>
+using instrumented_error = error_for<instrumented_input<Input>, Tag>;
+template <typename Production, typename Input>
+using instrumented_error_context = error_context<Production, instrumented_input<Input>>;
+} // namespace lexy
+
+#endif // LEXY_INPUT_INSTRUMENTED_INPUT_HPP_INCLUDED
@@ -0,0 +1,86 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_INPUT_PADDED_INPUT_HPP_INCLUDED
+#define LEXY_INPUT_PADDED_INPUT_HPP_INCLUDED
+
+#include <lexy/_detail/assert.hpp>
+#include <lexy/error.hpp>
+#include <lexy/input/base.hpp>
+#include <lexy/lexeme.hpp>
+
+namespace lexy
+{
+/// An input that refers to memory owned by the caller which has room for at least one more
+/// character after the input.
+/// For encodings with spare code points, it writes an EOF sentinel there, like `lexy::buffer`.
+/// This allows branch-less detection of EOF without copying the input.
+template <typename Encoding = default_encoding>
+class padded_input
+{
+public:
+    using encoding  = Encoding;
+    using char_type = typename encoding::char_type;
+
+    using iterator = const char_type*;
+
+    //=== constructors ===//
+    /// The memory `[data, data + capacity)` must be writable and `size < capacity`.
+    /// The character at `data[size]` is overwritten.
+    constexpr padded_input(char_type* data, std::size_t size, std::size_t capacity) noexcept
+    : _begin(data), _end(data + size)
+    {
+        LEXY_PRECONDITION(size < capacity);
+        (void)capacity;
+
+        if constexpr (_detail::has_eof_sentinel<encoding>)
+            data[size] = encoding::eof();
+    }
+
+    template <typename CharT, typename = _require_secondary_char_type<Encoding, CharT>>
+    padded_input(CharT* data, std::size_t size, std::size_t capacity) noexcept
+    : padded_input(reinterpret_cast<char_type*>(data), size, capacity)
+    {
+        static_assert(sizeof(CharT) == sizeof(char_type));
+    }
+
+    //=== access ===//
+    constexpr iterator begin() const noexcept
+    {
+        return _begin;
+    }
+
+    constexpr iterator end() const noexcept
+    {
+        return _end;
+    }
+
+    //=== reader ===//
+    constexpr auto reader() const& noexcept
+    {
+        if constexpr (_detail::has_eof_sentinel<encoding>)
+            return _detail::sentinel_reader<encoding>(_begin);
+        else
+            return _detail::range_reader<encoding, iterator>(_begin, _end);
+    }
+
+private:
+    iterator _begin, _end;
+};
+
+template <typename CharT>
+padded_input(CharT*, std::size_t, std::size_t) -> padded_input<deduce_encoding<CharT>>;
+
+//=== convenience typedefs ===//
+template <typename Encoding = default_encoding>
+using padded_lexeme = lexeme_for<padded_input<Encoding>>;
+
+template <typename Tag, typename Encoding = default_encoding>
+using padded_error = error_for<padded_input<Encoding>, Tag>;
+
+template <typename Production, typename Encoding = default_encoding>
+using padded_error_context = error_context<Production, padded_input<Encoding>>;
+} // namespace lexy
+
+#endif // LEXY_INPUT_PADDED_INPUT_HPP_INCLUDED
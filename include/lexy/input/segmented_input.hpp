@@ -0,0 +1,274 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_INPUT_SEGMENTED_INPUT_HPP_INCLUDED
+#define LEXY_INPUT_SEGMENTED_INPUT_HPP_INCLUDED
+
+#include <lexy/_detail/assert.hpp>
+#include <lexy/_detail/iterator.hpp>
+#include <lexy/error.hpp>
+#include <lexy/input/base.hpp>
+#include <lexy/lexeme.hpp>
+
+namespace lexy
+{
+/// A contiguous piece of a segmented input, e.g. an `iovec` or a rope chunk.
+template <typename CharT>
+struct input_segment
+{
+    const CharT* data;
+    std::size_t  size;
+};
+
+/// An iterator over the characters of multiple segments.
+///
+/// It never points to the end of a segment unless it is the end of the input,
+/// so positions are unique.
+template <typename CharT>
+class segment_iterator
+: public _detail::bidirectional_iterator_base<segment_iterator<CharT>, const CharT>
+{
+    using _segment = input_segment<CharT>;
+
+public:
+    using difference_type = std::ptrdiff_t;
+
+    constexpr segment_iterator() noexcept : _seg(nullptr), _last(nullptr), _c(nullptr) {}
+
+    constexpr const CharT& deref() const noexcept
+    {
+        return *_c;
+    }
+
+    constexpr void increment() noexcept
+    {
+        LEXY_PRECONDITION(_c != _seg_end(_seg));
+        ++_c;
+        if (_c == _seg_end(_seg) && _seg != _last)
+            _next_segment();
+    }
+    constexpr void decrement() noexcept
+    {
+        if (_c == _seg->data)
+        {
+            // Go to the last character of the previous non-empty segment.
+            do
+                --_seg;
+            while (_seg->size == 0);
+            _c = _seg_end(_seg) - 1;
+        }
+        else
+            --_c;
+    }
+
+    constexpr bool equal(segment_iterator rhs) const noexcept
+    {
+        return _seg == rhs._seg && _c == rhs._c;
+    }
+
+    /// The number of characters between the two iterators; `rhs` must not be after `lhs`.
+    friend constexpr difference_type operator-(segment_iterator lhs, segment_iterator rhs) noexcept
+    {
+        if (lhs._seg == rhs._seg)
+            return lhs._c - rhs._c;
+
+        LEXY_PRECONDITION(rhs._seg < lhs._seg);
+        auto result = _seg_end(rhs._seg) - rhs._c;
+        for (auto seg = rhs._seg + 1; seg != lhs._seg; ++seg)
+            result += static_cast<difference_type>(seg->size);
+        return result + (lhs._c - lhs._seg->data);
+    }
+
+    /// The segment the iterator points into.
+    constexpr const _segment* segment() const noexcept
+    {
+        return _seg;
+    }
+    /// A pointer to the character in the segment.
+    constexpr const CharT* ptr() const noexcept
+    {
+        return _c;
+    }
+
+private:
+    static constexpr const CharT* _seg_end(const _segment* seg) noexcept
+    {
+        return seg == nullptr ? nullptr : seg->data + seg->size;
+    }
+
+    constexpr explicit segment_iterator(const _segment* seg, const _segment* last,
+                                        const CharT* c) noexcept
+    : _seg(seg), _last(last), _c(c)
+    {}
+
+    // Creates the iterator to the beginning of the segments.
+    constexpr explicit segment_iterator(const _segment* first, const _segment* last) noexcept
+    : _seg(first), _last(last), _c(first == nullptr ? nullptr : first->data)
+    {
+        if (_c == _seg_end(_seg) && _seg != _last)
+            _next_segment();
+    }
+
+    constexpr void _next_segment() noexcept
+    {
+        // Skip over empty segments, but stop at the last one.
+        do
+            ++_seg;
+        while (_seg->size == 0 && _seg != _last);
+        _c = _seg->data;
+    }
+
+    const _segment* _seg;
+    const _segment* _last;
+    const CharT*    _c;
+
+    template <typename Encoding>
+    friend class _segmented_reader;
+    template <typename Encoding>
+    friend class segmented_input;
+};
+
+// Reads the characters of the current segment using a plain pointer;
+// it only looks at the segment list when it reaches the end of a segment.
+template <typename Encoding>
+class _segmented_reader
+{
+public:
+    using encoding         = Encoding;
+    using char_type        = typename encoding::char_type;
+    using iterator         = segment_iterator<char_type>;
+    using canonical_reader = _segmented_reader<Encoding>;
+
+    constexpr explicit _segmented_reader(iterator begin) noexcept
+    : _seg(begin._seg), _last(begin._last), _c(begin._c), _end(iterator::_seg_end(begin._seg))
+    {}
+
+    constexpr bool eof() const noexcept
+    {
+        // As the iterator never points to the end of a segment, this can only be the end.
+        return _c == _end;
+    }
+
+    constexpr auto peek() const noexcept
+    {
+        if (_c == _end)
+            return encoding::eof();
+        else
+            return encoding::to_int_type(*_c);
+    }
+
+    constexpr void bump() noexcept
+    {
+        LEXY_PRECONDITION(_c != _end);
+        ++_c;
+        if (_c == _end && _seg != _last)
+        {
+            // Go to the next segment.
+            auto next = cur();
+            next._next_segment();
+
+            _seg = next._seg;
+            _c   = next._c;
+            _end = iterator::_seg_end(_seg);
+        }
+    }
+
+    constexpr iterator cur() const noexcept
+    {
+        return iterator(_seg, _last, _c);
+    }
+
+private:
+    const input_segment<char_type>* _seg;
+    const input_segment<char_type>* _last;
+    const char_type*                _c;
+    const char_type*                _end;
+};
+
+/// An input that consists of multiple non-contiguous segments of memory.
+template <typename Encoding = default_encoding>
+class segmented_input
+{
+public:
+    using encoding  = Encoding;
+    using char_type = typename encoding::char_type;
+    using segment   = input_segment<char_type>;
+
+    using iterator = segment_iterator<char_type>;
+
+    //=== constructors ===//
+    constexpr segmented_input() noexcept : _first(nullptr), _last(nullptr) {}
+
+    /// The segments must outlive the input.
+    constexpr segmented_input(const segment* segments, std::size_t count) noexcept
+    : _first(count == 0 ? nullptr : segments), _last(count == 0 ? nullptr : segments + count - 1)
+    {}
+
+    template <typename Container>
+    constexpr explicit segmented_input(const Container& segments) noexcept
+    : segmented_input(segments.data(), segments.size())
+    {}
+
+    //=== access ===//
+    constexpr iterator begin() const noexcept
+    {
+        return iterator(_first, _last);
+    }
+
+    constexpr iterator end() const noexcept
+    {
+        if (_last == nullptr)
+            return iterator();
+        else
+            return iterator(_last, _last, _last->data + _last->size);
+    }
+
+    //=== reader ===//
+    constexpr auto reader() const& noexcept
+    {
+        return _segmented_reader<encoding>(begin());
+    }
+
+private:
+    const segment* _first;
+    const segment* _last;
+};
+
+template <typename CharT>
+segmented_input(const input_segment<CharT>*, std::size_t)
+    -> segmented_input<deduce_encoding<CharT>>;
+
+//=== convenience typedefs ===//
+template <typename Encoding = default_encoding>
+using segmented_lexeme = lexeme_for<segmented_input<Encoding>>;
+
+template <typename Tag, typename Encoding = default_encoding>
+using segmented_error = error_for<segmented_input<Encoding>, Tag>;
+
+template <typename Production, typename Encoding = default_encoding>
+using segmented_error_context = error_context<Production, segmented_input<Encoding>>;
+
+/// Returns a pointer to the `lexeme.size()` characters of the lexeme.
+/// If it lies in a single segment, it points into the segment;
+/// otherwise, the characters are copied into the `buffer` first.
+template <typename Encoding, typename Buffer>
+constexpr auto segmented_lexeme_data(const lexeme<_segmented_reader<Encoding>>& lexeme,
+                                     Buffer&                                    buffer)
+    -> const typename Encoding::char_type*
+{
+    auto begin = lexeme.begin();
+    auto size  = lexeme.size();
+    if (begin.segment() == nullptr
+        || begin.ptr() + size <= begin.segment()->data + begin.segment()->size)
+        // All characters are in the segment of begin.
+        return begin.ptr();
+
+    buffer.clear();
+    for (auto cur = begin; cur != lexeme.end(); ++cur)
+        buffer.push_back(*cur);
+    return buffer.data();
+}
+} // namespace lexy
+
+#endif // LEXY_INPUT_SEGMENTED_INPUT_HPP_INCLUDED
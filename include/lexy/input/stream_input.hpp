@@ -0,0 +1,266 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_INPUT_STREAM_INPUT_HPP_INCLUDED
+#define LEXY_INPUT_STREAM_INPUT_HPP_INCLUDED
+
+#include <lexy/_detail/assert.hpp>
+#include <lexy/_detail/buffer_builder.hpp>
+#include <lexy/_detail/iterator.hpp>
+#include <lexy/error.hpp>
+#include <lexy/input/base.hpp>
+#include <lexy/lexeme.hpp>
+
+namespace lexy
+{
+#if 0
+/// Produces the characters of a stream.
+class Source
+{
+    /// Reads at most `size` characters into the `buffer`.
+    /// Returns the number of characters read; zero means the stream has ended.
+    std::size_t operator()(char_type* buffer, std::size_t size);
+};
+#endif
+
+// The part of the stream that is currently in memory.
+template <typename CharT>
+class _stream_window
+{
+public:
+    // The position one past the last character that has been read.
+    std::size_t end() const noexcept
+    {
+        return _offset + _buffer.read_size();
+    }
+
+    const CharT& at(std::size_t pos) const noexcept
+    {
+        LEXY_PRECONDITION(_offset <= pos && pos < end());
+        return _buffer.read_data()[pos - _offset];
+    }
+
+    // Everything before `pos` is no longer needed.
+    void commit(std::size_t pos) noexcept
+    {
+        if (pos > _committed)
+            _committed = pos;
+    }
+
+    // Reads more characters from the source, returns false if there are none.
+    template <typename Source>
+    bool fill(Source& source)
+    {
+        if (_done)
+            return false;
+
+        if (_buffer.write_size() == 0)
+        {
+            // Only slide the window if that frees a good part of it;
+            // otherwise the uncommitted part is too big for the buffer and it needs to grow.
+            // This keeps the buffer within a constant factor of the biggest uncommitted part.
+            auto discardable = _committed - _offset;
+            if (discardable > 0 && discardable >= _buffer.read_size() / 2)
+            {
+                _buffer.discard(discardable);
+                _offset = _committed;
+            }
+            else
+            {
+                _buffer.grow();
+            }
+        }
+
+        auto count = source(_buffer.write_data(), _buffer.write_size());
+        if (count == 0)
+        {
+            _done = true;
+            return false;
+        }
+
+        LEXY_PRECONDITION(count <= _buffer.write_size());
+        _buffer.commit(count);
+        return true;
+    }
+
+    // The number of characters currently kept in memory.
+    std::size_t capacity() const noexcept
+    {
+        return _buffer.capacity();
+    }
+
+private:
+    _detail::buffer_builder<CharT> _buffer;
+    // The position of the first character in the buffer.
+    std::size_t _offset    = 0;
+    std::size_t _committed = 0;
+    bool        _done      = false;
+};
+
+/// An iterator into a `stream_input`.
+///
+/// It stores the position in the stream, so it is only valid while that position is in the
+/// window, i.e. until the input is committed past it.
+template <typename CharT>
+class stream_iterator
+: public _detail::bidirectional_iterator_base<stream_iterator<CharT>, const CharT>
+{
+public:
+    using difference_type = std::ptrdiff_t;
+
+    constexpr stream_iterator() noexcept : _window(nullptr), _pos(0) {}
+
+    const CharT& deref() const noexcept
+    {
+        return _window->at(_pos);
+    }
+
+    constexpr void increment() noexcept
+    {
+        ++_pos;
+    }
+    constexpr void decrement() noexcept
+    {
+        --_pos;
+    }
+
+    constexpr bool equal(stream_iterator rhs) const noexcept
+    {
+        return _pos == rhs._pos;
+    }
+
+    friend constexpr difference_type operator-(stream_iterator lhs, stream_iterator rhs) noexcept
+    {
+        return static_cast<difference_type>(lhs._pos) - static_cast<difference_type>(rhs._pos);
+    }
+
+    /// The number of characters from the beginning of the stream.
+    constexpr std::size_t position() const noexcept
+    {
+        return _pos;
+    }
+
+private:
+    constexpr explicit stream_iterator(const _stream_window<CharT>* window,
+                                       std::size_t                  pos) noexcept
+    : _window(window), _pos(pos)
+    {}
+
+    const _stream_window<CharT>* _window;
+    std::size_t                  _pos;
+
+    template <typename Source, typename Encoding>
+    friend class _stream_reader;
+};
+
+template <typename Source, typename Encoding>
+class stream_input;
+
+template <typename Source, typename Encoding>
+class _stream_reader
+{
+public:
+    using encoding         = Encoding;
+    using char_type        = typename encoding::char_type;
+    using iterator         = stream_iterator<char_type>;
+    using canonical_reader = _stream_reader<Source, Encoding>;
+
+    bool eof() const
+    {
+        // We only ask the source for more once we've reached the end of the window.
+        return _pos == _input->_window.end() && !_input->_window.fill(_input->_source);
+    }
+
+    auto peek() const
+    {
+        if (eof())
+            return encoding::eof();
+        else
+            return encoding::to_int_type(_input->_window.at(_pos));
+    }
+
+    void bump() noexcept
+    {
+        LEXY_PRECONDITION(_pos < _input->_window.end());
+        ++_pos;
+    }
+
+    iterator cur() const noexcept
+    {
+        return iterator(&_input->_window, _pos);
+    }
+
+    /// Everything before the current position can be discarded.
+    void commit() noexcept
+    {
+        _input->_window.commit(_pos);
+    }
+
+private:
+    explicit _stream_reader(const stream_input<Source, Encoding>& input) noexcept
+    : _input(&input), _pos(0)
+    {}
+
+    const stream_input<Source, Encoding>* _input;
+    std::size_t                           _pos;
+
+    friend stream_input<Source, Encoding>;
+};
+
+/// An input that reads characters from a source on demand, e.g. a socket.
+///
+/// Only a window of the stream is kept in memory: it slides forward past the positions that have
+/// been committed using `dsl::commit`. Without commits, the entire stream is kept.
+template <typename Source, typename Encoding = default_encoding>
+class stream_input
+{
+public:
+    using encoding    = Encoding;
+    using char_type   = typename encoding::char_type;
+    using source_type = Source;
+
+    using iterator = stream_iterator<char_type>;
+
+    //=== constructors ===//
+    explicit stream_input(Source source) : _source(LEXY_MOV(source)) {}
+
+    stream_input(const stream_input&) = delete;
+    stream_input& operator=(const stream_input&) = delete;
+
+    //=== access ===//
+    /// The number of characters the input currently keeps in memory.
+    std::size_t window_capacity() const noexcept
+    {
+        return _window.capacity();
+    }
+
+    //=== reader ===//
+    /// The input can only be read once.
+    auto reader() const& noexcept
+    {
+        return _stream_reader<Source, Encoding>(*this);
+    }
+
+private:
+    mutable _stream_window<char_type> _window;
+    LEXY_EMPTY_MEMBER mutable Source  _source;
+
+    friend _stream_reader<Source, Encoding>;
+};
+
+template <typename Source>
+stream_input(Source) -> stream_input<Source>;
+
+//=== convenience typedefs ===//
+template <typename Source, typename Encoding = default_encoding>
+using stream_lexeme = lexeme_for<stream_input<Source, Encoding>>;
+
+template <typename Tag, typename Source, typename Encoding = default_encoding>
+using stream_error = error_for<stream_input<Source, Encoding>, Tag>;
+
+template <typename Production, typename Source, typename Encoding = default_encoding>
+using stream_error_context = error_context<Production, stream_input<Source, Encoding>>;
+} // namespace lexy
+
+#endif // LEXY_INPUT_STREAM_INPUT_HPP_INCLUDED
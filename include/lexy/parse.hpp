@@ -214,6 +214,26 @@ constexpr auto parse(const Input& input, Callback callback)
 }
 } // namespace lexy
 
+/// Declares a function `Name(const Input& input, const ErrorCallback& callback)` that parses like
+/// `lexy::parse()` and returns `lexy::parse_result<T, ErrorCallback>`.
+/// It can be called without including the grammar; only the types need to be complete.
+/// Types that contain a comma need to be passed as a type alias.
+#define LEXY_DECLARE_PARSER(Name, T, Input, ErrorCallback)                                         \
+    ::lexy::parse_result<T, ::std::remove_cv_t<ErrorCallback>> Name(const Input&         input,    \
+                                                                    const ErrorCallback& callback)
+
+/// Defines the function declared by `LEXY_DECLARE_PARSER()` to parse `Production`.
+/// The grammar is then only instantiated in the translation unit of the definition.
+#define LEXY_DEFINE_PARSER(Name, Production, T, Input, ErrorCallback)                              \
+    LEXY_DECLARE_PARSER(Name, T, Input, ErrorCallback)                                             \
+    {                                                                                              \
+        using _result_type = ::lexy::parse_result<T, ::std::remove_cv_t<ErrorCallback>>;           \
+        static_assert(::std::is_same_v<decltype(::lexy::parse<Production>(input, callback)),       \
+                                       _result_type>,                                              \
+                      "T is not the value type of the production");                                \
+        return ::lexy::parse<Production>(input, callback);                                         \
+    }
+
 namespace lexyd
 {
 template <auto Fn>
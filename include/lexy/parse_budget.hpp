@@ -0,0 +1,243 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_PARSE_BUDGET_HPP_INCLUDED
+#define LEXY_PARSE_BUDGET_HPP_INCLUDED
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <lexy/dsl/base.hpp>
+#include <lexy/error.hpp>
+#include <lexy/parse.hpp>
+#include <lexy/validate.hpp>
+
+namespace lexy
+{
+/// Limits the resources a single parse can use.
+/// The budget is checked whenever a production is started, in every iteration of a loop and
+/// before error recovery; parsing stops with a `lexy::budget_exceeded` error once any of them is
+/// exhausted.
+struct parse_budget
+{
+    /// The maximal number of code units of accepted tokens.
+    /// Tokens that are accepted again after backtracking count again,
+    /// but input read by failed attempts or lookahead doesn't count.
+    std::size_t max_token_units = std::size_t(-1);
+    /// The maximal nesting depth of productions.
+    std::size_t max_depth = std::size_t(-1);
+    /// Parsing stops once it is set to true, e.g. by another thread.
+    const std::atomic<bool>* cancel = nullptr;
+    /// Parsing stops after that point in time.
+    /// It is only checked every `deadline_interval` checks, as getting the time isn't free.
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+    std::size_t                           deadline_interval = 256;
+};
+
+/// The reason a parse was stopped.
+enum class budget_kind
+{
+    token_units,
+    depth,
+    cancel,
+    deadline,
+};
+
+/// A budget of `lexy::parse_budget` was exhausted.
+struct budget_exceeded
+{};
+template <typename Reader>
+class error<Reader, budget_exceeded>
+{
+    static_assert(is_canonical_reader<Reader>);
+
+public:
+    constexpr explicit error(typename Reader::iterator pos, budget_kind kind) noexcept
+    : _pos(pos), _kind(kind)
+    {}
+
+    constexpr auto position() const noexcept
+    {
+        return _pos;
+    }
+    constexpr auto begin() const noexcept
+    {
+        return _pos;
+    }
+    constexpr auto end() const noexcept
+    {
+        return _pos;
+    }
+
+    constexpr budget_kind kind() const noexcept
+    {
+        return _kind;
+    }
+
+    constexpr const char* message() const noexcept
+    {
+        switch (_kind)
+        {
+        case budget_kind::token_units:
+            return "token unit budget exceeded";
+        case budget_kind::depth:
+            return "depth budget exceeded";
+        case budget_kind::cancel:
+            return "parsing canceled";
+        case budget_kind::deadline:
+            return "deadline exceeded";
+        }
+        return "budget exceeded";
+    }
+
+private:
+    typename Reader::iterator _pos;
+    budget_kind               _kind;
+};
+} // namespace lexy
+
+namespace lexy
+{
+// Forwards to another handler while keeping track of the budget.
+template <typename Handler>
+class _budget_handler
+{
+public:
+    constexpr explicit _budget_handler(Handler& handler, const parse_budget& budget)
+    : _handler(&handler), _budget(&budget), _token_units(0), _depth(0), _countdown(0),
+      _exceeded(false)
+    {}
+
+    constexpr auto& get_state()
+    {
+        return _handler->get_state();
+    }
+
+    //=== handler functions ===//
+    template <typename Production>
+    using return_type_for = typename Handler::template return_type_for<Production>;
+
+    template <typename Production>
+    constexpr auto get_sink(Production p)
+    {
+        return _handler->get_sink(p);
+    }
+
+    template <typename Production, typename Iterator>
+    constexpr auto start_production(Production p, Iterator pos)
+    {
+        ++_depth;
+        return _handler->start_production(p, pos);
+    }
+
+    template <typename Kind, typename Iterator>
+    constexpr void token(Kind kind, Iterator begin, Iterator end)
+    {
+        _token_units += lexy::_detail::range_size(begin, end);
+        _handler->token(kind, begin, end);
+    }
+
+    template <typename Production, typename State, typename... Args>
+    constexpr auto finish_production(Production p, State&& state, Args&&... args)
+    {
+        --_depth;
+        return _handler->finish_production(p, LEXY_FWD(state), LEXY_FWD(args)...);
+    }
+    template <typename Production, typename State>
+    constexpr void backtrack_production(Production p, State&& state)
+    {
+        --_depth;
+        _handler->backtrack_production(p, LEXY_FWD(state));
+    }
+
+    template <typename Production, typename State, typename Error>
+    constexpr void error(Production p, State&& state, Error&& error)
+    {
+        _handler->error(p, LEXY_FWD(state), LEXY_FWD(error));
+    }
+
+    template <typename Context, typename Reader>
+    constexpr bool check_budget(Context& context, const Reader& reader)
+    {
+        if (_exceeded)
+            // We've already reported the error, so just unwind; this also cancels any recovery.
+            return false;
+
+        auto kind = budget_kind::token_units;
+        if (!_is_exhausted(kind))
+            return true;
+
+        _exceeded = true;
+        context.error(lexy::make_error<Reader, budget_exceeded>(reader.cur(), kind));
+        return false;
+    }
+
+private:
+    constexpr bool _is_exhausted(budget_kind& kind)
+    {
+        if (_token_units > _budget->max_token_units)
+            kind = budget_kind::token_units;
+        else if (_depth > _budget->max_depth)
+            kind = budget_kind::depth;
+        else if (_budget->cancel && _budget->cancel->load(std::memory_order_relaxed))
+            kind = budget_kind::cancel;
+        else if (_countdown-- == 0 && _is_past_deadline())
+            kind = budget_kind::deadline;
+        else
+            return false;
+
+        return true;
+    }
+
+    bool _is_past_deadline()
+    {
+        _countdown = _budget->deadline_interval;
+        return _budget->deadline != std::chrono::steady_clock::time_point::max()
+               && std::chrono::steady_clock::now() > _budget->deadline;
+    }
+
+    Handler*            _handler;
+    const parse_budget* _budget;
+    std::size_t         _token_units;
+    std::size_t         _depth;
+    std::size_t         _countdown;
+    bool                _exceeded;
+};
+
+template <typename Handler>
+constexpr bool _is_parse_handler<_budget_handler<Handler>> = _is_parse_handler<Handler>;
+
+/// Parses the production like `lexy::parse()`, but stops once the budget is exhausted.
+template <typename Production, typename Input, typename State, typename Callback>
+auto parse_with_budget(const Input& input, State&& state, const parse_budget& budget,
+                       Callback callback)
+{
+    auto handler        = lexy::_parse_handler(state, input, LEXY_MOV(callback));
+    auto budget_handler = lexy::_budget_handler(handler, budget);
+    auto reader         = input.reader();
+
+    auto value = lexy::_detail::parse_impl<Production>(budget_handler, reader);
+    return LEXY_MOV(handler).get_result(LEXY_MOV(value));
+}
+template <typename Production, typename Input, typename Callback>
+auto parse_with_budget(const Input& input, const parse_budget& budget, Callback callback)
+{
+    return parse_with_budget<Production>(input, _no_parse_state{}, budget, LEXY_MOV(callback));
+}
+
+/// Validates the production like `lexy::validate()`, but stops once the budget is exhausted.
+template <typename Production, typename Input, typename ErrorCallback>
+auto validate_with_budget(const Input& input, const parse_budget& budget,
+                          const ErrorCallback& callback) -> validate_result<ErrorCallback>
+{
+    auto handler        = validate_handler(input, callback);
+    auto budget_handler = lexy::_budget_handler(handler, budget);
+    auto reader         = input.reader();
+
+    auto did_recover = lexy::_detail::parse_impl<Production>(budget_handler, reader);
+    return LEXY_MOV(handler).get_result(static_cast<bool>(did_recover));
+}
+} // namespace lexy
+
+#endif // LEXY_PARSE_BUDGET_HPP_INCLUDED
@@ -0,0 +1,212 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_PARSE_EVENTS_HPP_INCLUDED
+#define LEXY_PARSE_EVENTS_HPP_INCLUDED
+
+#include <lexy/_detail/buffer_builder.hpp>
+#include <lexy/_detail/detect.hpp>
+#include <lexy/dsl/base.hpp>
+#include <lexy/lexeme.hpp>
+#include <lexy/validate.hpp>
+#include <new>
+
+namespace lexy
+{
+#if 0
+/// Receives the events of `lexy::parse_events()`.
+/// Both functions are optional and can be overloaded for the productions that are of interest.
+class Visitor
+{
+    /// Called once the production has matched its first token, so it can no longer backtrack.
+    void start(Production);
+    /// Called after the production has been parsed with the input it has consumed.
+    /// Unless it is a token production, this includes whitespace after its last token.
+    void finish(Production, lexy::lexeme<Reader> lexeme);
+};
+#endif
+
+template <typename Visitor, typename Production>
+using _detect_visitor_start = decltype(LEXY_DECLVAL(Visitor&).start(Production{}));
+template <typename Visitor, typename Production, typename Lexeme>
+using _detect_visitor_finish = decltype(LEXY_DECLVAL(Visitor&).finish(Production{}, Lexeme{}));
+
+template <typename Input, typename Visitor, typename ErrorCallback>
+class _event_handler
+{
+    using _reader   = lexy::input_reader<Input>;
+    using _iterator = typename _reader::iterator;
+    using _lexeme   = lexy::lexeme<_reader>;
+
+    static_assert(std::is_trivially_copyable_v<_iterator>);
+
+    // The events of a production are only reported once it can no longer be backtracked.
+    // Until then, we keep functions that report them: the start of the production,
+    // and the finish of child productions that haven't consumed a token.
+    struct _event
+    {
+        void (*report)(Visitor& visitor, const _event& event);
+        // The position of a finished production, which is empty.
+        alignas(_iterator) unsigned char pos[sizeof(_iterator)];
+    };
+
+    template <typename Production>
+    static void _start(Visitor& visitor, const _event&)
+    {
+        if constexpr (lexy::_detail::is_detected<_detect_visitor_start, Visitor, Production>)
+            visitor.start(Production{});
+        else
+            (void)visitor;
+    }
+
+    template <typename Production>
+    static void _finish(Visitor& visitor, const _event& event)
+    {
+        auto pos = *std::launder(reinterpret_cast<const _iterator*>(event.pos));
+        visitor.finish(Production{}, _lexeme(pos, pos));
+    }
+
+public:
+    constexpr explicit _event_handler(Visitor& visitor, const Input& input,
+                                      const ErrorCallback& callback)
+    : _visitor(&visitor), _reported(0), _last_end(), _token_count(0), _validate(input, callback)
+    {}
+
+    constexpr auto get_result(bool did_recover) &&
+    {
+        return LEXY_MOV(_validate).get_result(did_recover);
+    }
+
+    //=== handler functions ===//
+    template <typename Production>
+    using return_type_for = void;
+
+    template <typename Production>
+    constexpr auto get_sink(Production)
+    {
+        return noop.sink();
+    }
+
+    struct _state_t
+    {
+        _iterator begin;
+        // The index of the start event of the production, counting reported events as well.
+        std::size_t event_index;
+        std::size_t token_count;
+    };
+
+    template <typename Production, typename Iterator>
+    constexpr _state_t start_production(Production, Iterator pos)
+    {
+        // We always add the event, even if the visitor doesn't care,
+        // its index tells whether the production is still pending.
+        auto event_index = _reported + _pending.read_size();
+        _push(&_start<Production>);
+        return {pos, event_index, _token_count};
+    }
+
+    template <typename Kind, typename Iterator>
+    constexpr void token(Kind, Iterator, Iterator end)
+    {
+        // A token was matched, so none of the current productions can backtrack.
+        _report_pending();
+
+        _last_end = end;
+        ++_token_count;
+    }
+
+    template <typename Production, typename... Args>
+    constexpr void finish_production(Production, _state_t&& state, Args&&...)
+    {
+        constexpr auto has_finish
+            = lexy::_detail::is_detected<_detect_visitor_finish, Visitor, Production, _lexeme>;
+
+        if (state.event_index > _reported)
+        {
+            // The parent production is still pending, so this one hasn't consumed a token.
+            // It can still be backtracked together with the parent, so only remember the finish.
+            if constexpr (has_finish)
+            {
+                auto& event = _push(&_finish<Production>);
+                ::new (static_cast<void*>(event.pos)) _iterator(state.begin);
+            }
+        }
+        else
+        {
+            // The production is finished and its parent can no longer backtrack,
+            // so its pending events, and those of its children, are final.
+            _report_pending();
+
+            if constexpr (has_finish)
+            {
+                auto end = state.token_count == _token_count ? state.begin : _last_end;
+                _visitor->finish(Production{}, _lexeme(state.begin, end));
+            }
+        }
+    }
+    template <typename Production>
+    constexpr void backtrack_production(Production, _state_t&& state)
+    {
+        // Forget the events of the production and its children that are still pending.
+        if (state.event_index > _reported)
+            _pending.truncate(state.event_index - _reported);
+        else
+            _pending.truncate(0);
+    }
+
+    template <typename Production, typename Error>
+    constexpr void error(Production p, _state_t&& state, Error&& error)
+    {
+        _validate.error(p, state.begin, LEXY_FWD(error));
+    }
+
+private:
+    constexpr _event& _push(void (*report)(Visitor&, const _event&))
+    {
+        if (_pending.write_size() == 0)
+            _pending.grow();
+
+        auto event    = _pending.write_data();
+        event->report = report;
+        _pending.commit(1);
+        return *event;
+    }
+
+    constexpr void _report_pending()
+    {
+        for (std::size_t i = 0; i != _pending.read_size(); ++i)
+        {
+            auto& event = _pending.read_data()[i];
+            event.report(*_visitor, event);
+        }
+
+        _reported += _pending.read_size();
+        _pending.clear();
+    }
+
+    Visitor*                              _visitor;
+    lexy::_detail::buffer_builder<_event> _pending;
+    std::size_t                           _reported;
+    _iterator                             _last_end;
+    std::size_t                           _token_count;
+
+    lexy::validate_handler<Input, ErrorCallback> _validate;
+};
+
+/// Parses the production and reports its productions to the visitor instead of producing values.
+/// Only the current nesting of productions is kept in memory.
+template <typename Production, typename Input, typename Visitor, typename ErrorCallback>
+auto parse_events(const Input& input, Visitor& visitor, const ErrorCallback& callback)
+    -> validate_result<ErrorCallback>
+{
+    auto handler = _event_handler(visitor, input, callback);
+    auto reader  = input.reader();
+
+    auto did_recover = lexy::_detail::parse_impl<Production>(handler, reader);
+    return LEXY_MOV(handler).get_result(static_cast<bool>(did_recover));
+}
+} // namespace lexy
+
+#endif // LEXY_PARSE_EVENTS_HPP_INCLUDED
+
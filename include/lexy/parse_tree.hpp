@@ -5,8 +5,11 @@
 #ifndef LEXY_PARSE_TREE_HPP_INCLUDED
 #define LEXY_PARSE_TREE_HPP_INCLUDED
 
+#include <cstring>
+#include <new>
 #include <lexy/_detail/assert.hpp>
 #include <lexy/_detail/config.hpp>
+#include <lexy/_detail/detect.hpp>
 #include <lexy/_detail/iterator.hpp>
 #include <lexy/_detail/lazy_init.hpp>
 #include <lexy/_detail/memory_resource.hpp>
@@ -17,17 +20,86 @@
 #include <lexy/token.hpp>
 #include <lexy/validate.hpp>
 
+//=== layouts ===//
+namespace lexy
+{
+/// Nodes store pointers to each other and iterators into the input.
+struct parse_tree_pointer_layout
+{};
+
+/// Nodes store 32-bit links to each other and 32-bit offsets into the input.
+/// It requires a reader whose iterators are pointers, an input smaller than 4 GiB,
+/// and at most 4 GiB of nodes.
+struct parse_tree_compact_layout
+{};
+
+/// Nodes use the other layout, but production nodes additionally store a hash of their subtree.
+template <typename Layout = parse_tree_pointer_layout>
+struct parse_tree_hashed_layout
+{};
+} // namespace lexy
+
 //=== internal: pt_node ===//
 namespace lexy::_detail
 {
-template <typename Reader>
+template <typename Reader, typename Layout>
 struct pt_node;
-template <typename Reader>
+template <typename Reader, typename Layout>
 struct pt_node_token;
-template <typename Reader>
+template <typename Reader, typename Layout>
 struct pt_node_production;
 
-template <typename Reader>
+template <typename Layout>
+struct pt_layout_traits
+{
+    using base                   = Layout;
+    static constexpr bool hashed = false;
+};
+template <typename Layout>
+struct pt_layout_traits<parse_tree_hashed_layout<Layout>>
+{
+    using base                   = Layout;
+    static constexpr bool hashed = true;
+};
+
+template <typename Layout>
+constexpr auto pt_is_compact
+    = std::is_same_v<typename pt_layout_traits<Layout>::base, parse_tree_compact_layout>;
+template <typename Layout>
+constexpr auto pt_is_hashed = pt_layout_traits<Layout>::hashed;
+
+struct pt_block_table;
+
+// The header of a block of a compact parse tree.
+// Blocks are aligned to their size, so a node can find the block it is stored in.
+struct pt_compact_block
+{
+    static constexpr std::size_t size       = 4096;
+    static constexpr std::size_t max_blocks = std::size_t(1) << 20;
+
+    pt_compact_block* next;
+    pt_block_table*   table;
+    std::size_t       index;
+
+    static pt_compact_block* of(const void* ptr) noexcept
+    {
+        auto address = reinterpret_cast<std::uintptr_t>(ptr);
+        return reinterpret_cast<pt_compact_block*>(address & ~std::uintptr_t(size - 1));
+    }
+};
+
+// Shared by all blocks of a compact parse tree.
+struct pt_block_table
+{
+    // The beginning of the input; tokens store offsets relative to it.
+    const void* input;
+
+    pt_compact_block** blocks;
+    std::size_t        size;
+    std::size_t        capacity;
+};
+
+template <typename Reader, typename Layout>
 class pt_node_ptr
 {
 public:
@@ -41,20 +113,29 @@ public:
     // This means that it is automatically an empty child range.
     pt_node_ptr() noexcept : pt_node_ptr(nullptr, type_token, role_parent) {}
 
-    void set_sibling(pt_node<Reader>* ptr, unsigned type)
+    explicit pt_node_ptr(pt_node<Reader, Layout>* ptr, unsigned type, unsigned role)
+    : _value(reinterpret_cast<std::uintptr_t>(ptr))
+    {
+        LEXY_PRECONDITION((reinterpret_cast<std::uintptr_t>(ptr) & 0b11) == 0);
+
+        _value |= (role & 0b1) << 1;
+        _value |= (type & 0b1);
+    }
+
+    void set_sibling(pt_node<Reader, Layout>* ptr, unsigned type)
     {
         *this = pt_node_ptr(ptr, type, role_sibling);
     }
-    void set_sibling(pt_node_token<Reader>* ptr)
+    void set_sibling(pt_node_token<Reader, Layout>* ptr)
     {
         *this = pt_node_ptr(ptr, type_token, role_sibling);
     }
-    void set_sibling(pt_node_production<Reader>* ptr)
+    void set_sibling(pt_node_production<Reader, Layout>* ptr)
     {
         *this = pt_node_ptr(ptr, type_production, role_sibling);
     }
 
-    void set_parent(pt_node_production<Reader>* ptr)
+    void set_parent(pt_node_production<Reader, Layout>* ptr)
     {
         *this = pt_node_ptr(ptr, type_production, role_parent);
     }
@@ -69,88 +150,253 @@ public:
     {
         return _value & 0b1;
     }
+    unsigned role() const noexcept
+    {
+        return (_value & 0b10) >> 1;
+    }
 
     auto* base() const noexcept
     {
-        return reinterpret_cast<pt_node<Reader>*>(_value & ~std::uintptr_t(0b11));
+        return reinterpret_cast<pt_node<Reader, Layout>*>(_value & ~std::uintptr_t(0b11));
     }
 
     auto token() const noexcept
     {
-        return type() == type_token ? static_cast<pt_node_token<Reader>*>(base()) : nullptr;
+        return type() == type_token ? static_cast<pt_node_token<Reader, Layout>*>(base())
+                                    : nullptr;
     }
     auto production() const noexcept
     {
-        return type() == type_production ? static_cast<pt_node_production<Reader>*>(base())
-                                         : nullptr;
+        return type() == type_production
+                   ? static_cast<pt_node_production<Reader, Layout>*>(base())
+                   : nullptr;
     }
 
     bool is_sibling_ptr() const noexcept
     {
-        return ((_value & 0b10) >> 1) == role_sibling;
+        return role() == role_sibling;
     }
     bool is_parent_ptr() const noexcept
     {
-        return ((_value & 0b10) >> 1) == role_parent;
+        return role() == role_parent;
     }
 
 private:
-    explicit pt_node_ptr(pt_node<Reader>* ptr, unsigned type, unsigned role)
-    : _value(reinterpret_cast<std::uintptr_t>(ptr))
+    std::uintptr_t _value;
+};
+
+// The pointer to another node as it is stored in a node.
+template <typename Reader, typename Layout>
+class pt_link
+{
+    using ptr_t = pt_node_ptr<Reader, Layout>;
+
+    // A compact link is the index of the block, the offset of the node in the block in units of
+    // four bytes, and the role and type bits of the pointer.
+    static constexpr auto _offset_unit = std::size_t(4);
+    static constexpr auto _offset_bits = 10u;
+    static constexpr auto _index_bits  = 32u - _offset_bits - 2u;
+
+    static_assert(pt_compact_block::size == _offset_unit << _offset_bits);
+    static_assert(pt_compact_block::max_blocks == std::size_t(1) << _index_bits);
+
+public:
+    pt_link() noexcept : _value() {}
+
+    ptr_t get() const noexcept
     {
-        LEXY_PRECONDITION((reinterpret_cast<std::uintptr_t>(ptr) & 0b11) == 0);
+        if constexpr (pt_is_compact<Layout>)
+        {
+            auto offset = (_value >> 2) & ((1u << _offset_bits) - 1);
+            if (offset == 0)
+                // The header of a block can't contain a node, so it encodes nullptr.
+                return ptr_t();
+
+            auto index = _value >> (_offset_bits + 2);
+            auto block = pt_compact_block::of(this);
+            if (block->index != index)
+                block = block->table->blocks[index];
+
+            auto memory = reinterpret_cast<unsigned char*>(block) + offset * _offset_unit;
+            return ptr_t(reinterpret_cast<pt_node<Reader, Layout>*>(memory), _value & 0b1,
+                         (_value & 0b10) >> 1);
+        }
+        else
+        {
+            return _value;
+        }
+    }
 
-        _value |= (role & 0b1) << 1;
-        _value |= (type & 0b1);
+    void set(ptr_t ptr) noexcept
+    {
+        if constexpr (pt_is_compact<Layout>)
+        {
+            if (!ptr)
+            {
+                _value = 0;
+                return;
+            }
+
+            auto memory = reinterpret_cast<unsigned char*>(ptr.base());
+            auto block  = pt_compact_block::of(memory);
+            auto offset = std::size_t(memory - reinterpret_cast<unsigned char*>(block));
+            LEXY_PRECONDITION(offset % _offset_unit == 0);
+
+            _value = std::uint_least32_t(block->index << (_offset_bits + 2)
+                                         | (offset / _offset_unit) << 2 | ptr.role() << 1
+                                         | ptr.type());
+        }
+        else
+        {
+            _value = ptr;
+        }
     }
 
-    std::uintptr_t _value;
+    template <typename T>
+    void set_sibling(T* ptr) noexcept
+    {
+        ptr_t result;
+        result.set_sibling(ptr);
+        set(result);
+    }
+    void set_parent(pt_node_production<Reader, Layout>* ptr) noexcept
+    {
+        ptr_t result;
+        result.set_parent(ptr);
+        set(result);
+    }
+
+private:
+    std::conditional_t<pt_is_compact<Layout>, std::uint_least32_t, ptr_t> _value;
 };
 
-template <typename Reader>
+template <typename Reader, typename Layout>
 struct pt_node
 {
     // Either points back to the next child of the parent node (the sibling),
     // or back to the parent node if it is its last child.
     // It is only null for the root node.
-    pt_node_ptr<Reader> ptr;
+    pt_link<Reader, Layout> ptr;
 };
 
-template <typename Reader>
-struct pt_node_token : pt_node<Reader>
+// Combines the hash of a subtree with another value.
+constexpr std::uint_least64_t pt_hash_combine(std::uint_least64_t hash,
+                                              std::uint_least64_t value) noexcept
+{
+    hash ^= value + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+
+    // The finalizer of splitmix64, so every bit of the input affects every bit of the result.
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111eb;
+    return hash ^ (hash >> 31);
+}
+
+template <typename Iterator>
+std::uint_least64_t pt_hash_text(std::uint_least64_t hash, Iterator begin, Iterator end) noexcept
+{
+    std::size_t size = 0;
+    if constexpr (std::is_pointer_v<Iterator> && sizeof(*begin) == 1)
+    {
+        // Hash eight bytes at a time.
+        auto cur = reinterpret_cast<const unsigned char*>(begin);
+        size     = std::size_t(end - begin);
+
+        auto remaining = size;
+        for (; remaining >= 8; remaining -= 8, cur += 8)
+        {
+            std::uint_least64_t chunk;
+            std::memcpy(&chunk, cur, 8);
+            hash = pt_hash_combine(hash, chunk);
+        }
+
+        std::uint_least64_t tail = 0;
+        for (auto i = 0u; i != remaining; ++i)
+            tail |= std::uint_least64_t(cur[i]) << (8 * i);
+        hash = pt_hash_combine(hash, tail);
+    }
+    else
+    {
+        for (auto cur = begin; cur != end; ++cur, ++size)
+            hash = pt_hash_combine(hash, static_cast<std::uint_least64_t>(*cur));
+    }
+
+    // The size distinguishes the zero padding of the tail from actual zeros.
+    return pt_hash_combine(hash, size);
+}
+
+// Distinguishes a token from a production with the same text.
+constexpr std::uint_least64_t pt_hash_token_seed      = 0x01;
+constexpr std::uint_least64_t pt_hash_production_seed = 0x02;
+
+template <typename Reader, typename Layout>
+struct pt_node_token : pt_node<Reader, Layout>
 {
+    using iterator = typename Reader::iterator;
+
     // If it's not a pointer, we store size instead of end.
-    static constexpr auto _optimize_end = std::is_pointer_v<typename Reader::iterator>;
+    static constexpr auto _optimize_end = std::is_pointer_v<iterator>;
     using _end_t
         // If we can optimize it, we store the size as a uint32_t, otherwise the iterator.
-        = std::conditional_t<_optimize_end, std::uint_least32_t, typename Reader::iterator>;
+        = std::conditional_t<_optimize_end, std::uint_least32_t, iterator>;
+    using _begin_t
+        // A compact token stores the offset from the beginning of the input.
+        = std::conditional_t<pt_is_compact<Layout>, std::uint_least32_t, iterator>;
+
+    static_assert(_optimize_end || !pt_is_compact<Layout>,
+                  "compact parse tree requires a reader whose iterators are pointers");
 
-    typename Reader::iterator begin;
+    _begin_t                  begin_impl;
     _end_t                    end_impl;
-    ::uint_least16_t          kind;
+    std::uint_least16_t       kind;
 
-    explicit pt_node_token(std::uint_least16_t kind, typename Reader::iterator begin,
-                           typename Reader::iterator end) noexcept
-    : begin(begin), kind(kind)
+    explicit pt_node_token(std::uint_least16_t kind, iterator begin, iterator end) noexcept
+    : kind(kind)
     {
+        if constexpr (pt_is_compact<Layout>)
+        {
+            static_assert(sizeof(pt_node_token) == 4 * sizeof(std::uint_least32_t));
+
+            auto offset = std::size_t(begin - input());
+            LEXY_PRECONDITION(offset <= UINT_LEAST32_MAX);
+            begin_impl = std::uint_least32_t(offset);
+        }
+        else
+        {
+            begin_impl = begin;
+        }
+
         update_end(end);
     }
 
-    typename Reader::iterator end() const noexcept
+    // Tokens don't store their hash, it's cheap to compute.
+    std::uint_least64_t hash() const noexcept
+    {
+        return pt_hash_text(pt_hash_combine(pt_hash_token_seed, kind), begin(), end());
+    }
+
+    iterator begin() const noexcept
+    {
+        if constexpr (pt_is_compact<Layout>)
+            return input() + begin_impl;
+        else
+            return begin_impl;
+    }
+
+    iterator end() const noexcept
     {
         if constexpr (_optimize_end)
-            return begin + end_impl;
+            return begin() + end_impl;
         else
             return end_impl;
     }
 
-    void update_end(typename Reader::iterator end) noexcept
+    void update_end(iterator end) noexcept
     {
         if constexpr (_optimize_end)
         {
-            static_assert(sizeof(pt_node_token) == 3 * sizeof(void*));
+            static_assert(pt_is_compact<Layout> || sizeof(pt_node_token) == 3 * sizeof(void*));
 
-            auto size = std::size_t(end - begin);
+            auto size = std::size_t(end - begin());
             LEXY_PRECONDITION(size <= UINT_LEAST32_MAX);
             end_impl = std::uint_least32_t(size);
         }
@@ -161,50 +407,99 @@ struct pt_node_token : pt_node<Reader>
             end_impl = end;
         }
     }
+
+private:
+    iterator input() const noexcept
+    {
+        return static_cast<iterator>(pt_compact_block::of(this)->table->input);
+    }
 };
 
-template <typename Reader>
-struct pt_node_production : pt_node<Reader>
+// The beginning of a production node of a hashed layout.
+template <typename Reader, typename Layout>
+struct pt_node_hashed : pt_node<Reader, Layout>
 {
-    static constexpr std::size_t child_count_bits = sizeof(std::size_t) * CHAR_BIT - 3;
+    // Split, so it doesn't require more alignment than a compact node.
+    std::uint_least32_t hash_impl[2];
 
+    std::uint_least64_t hash() const noexcept
+    {
+        return std::uint_least64_t(hash_impl[1]) << 32 | hash_impl[0];
+    }
+
+    void set_hash(std::uint_least64_t hash) noexcept
+    {
+        hash_impl[0] = std::uint_least32_t(hash & 0xFFFF'FFFF);
+        hash_impl[1] = std::uint_least32_t(hash >> 32);
+    }
+};
+
+template <typename Reader, typename Layout>
+struct pt_node_production
+: std::conditional_t<pt_is_hashed<Layout>, pt_node_hashed<Reader, Layout>, pt_node<Reader, Layout>>
+{
+    using _count_t = std::conditional_t<pt_is_compact<Layout>, std::uint_least32_t, std::size_t>;
+    static constexpr std::size_t child_count_bits = sizeof(_count_t) * CHAR_BIT - 3;
+    static constexpr std::size_t hash_size
+        = pt_is_hashed<Layout> ? 2 * sizeof(std::uint_least32_t) : 0;
+
+    _count_t    child_count : child_count_bits;
+    _count_t    token_production : 1;
+    _count_t    first_child_adjacent : 1;
+    _count_t    first_child_type : 1;
     const char* name;
-    std::size_t child_count : child_count_bits;
-    std::size_t token_production : 1;
-    std::size_t first_child_adjacent : 1;
-    std::size_t first_child_type : 1;
 
     template <typename Production>
     explicit pt_node_production(Production) noexcept
     : child_count(0), token_production(lexy::is_token_production<Production>),
-      first_child_adjacent(true), first_child_type(pt_node_ptr<Reader>::type_token)
+      first_child_adjacent(true), first_child_type(pt_node_ptr<Reader, Layout>::type_token)
     {
-        static_assert(sizeof(pt_node_production) == 3 * sizeof(void*));
+        if constexpr (pt_is_compact<Layout>)
+            static_assert(sizeof(pt_node_production)
+                          == 2 * sizeof(std::uint_least32_t) + sizeof(void*) + hash_size);
+        else
+            static_assert(sizeof(pt_node_production) == 3 * sizeof(void*) + hash_size);
 
         name = lexy::production_name<Production>();
+        if constexpr (pt_is_hashed<Layout>)
+            this->set_hash(0);
     }
 
-    pt_node_ptr<Reader> first_child()
+    // Requires that the production and all its child productions are finished.
+    std::uint_least64_t compute_hash()
+    {
+        auto hash = pt_hash_text(pt_hash_production_seed, name, name + std::strlen(name));
+        for (auto child = first_child(); child.is_sibling_ptr(); child = child.base()->ptr.get())
+        {
+            if (auto token = child.token())
+                hash = pt_hash_combine(hash, token->hash());
+            else
+                hash = pt_hash_combine(hash, child.production()->hash());
+        }
+        return pt_hash_combine(hash, child_count);
+    }
+
+    pt_node_ptr<Reader, Layout> first_child()
     {
         auto memory = static_cast<void*>(this + 1);
         if (child_count == 0)
         {
             // We don't have a child at all.
-            pt_node_ptr<Reader> result;
+            pt_node_ptr<Reader, Layout> result;
             result.set_parent(this);
             return result;
         }
         else if (first_child_adjacent)
         {
             // The first child is stored immediately afterwards.
-            pt_node_ptr<Reader> result;
-            result.set_sibling(static_cast<pt_node<Reader>*>(memory), first_child_type);
+            pt_node_ptr<Reader, Layout> result;
+            result.set_sibling(static_cast<pt_node<Reader, Layout>*>(memory), first_child_type);
             return result;
         }
         else
         {
             // We're only storing a pointer to the first child immediately afterwards.
-            return *static_cast<pt_node_ptr<Reader>*>(memory);
+            return static_cast<pt_link<Reader, Layout>*>(memory)->get();
         }
     }
 };
@@ -213,51 +508,85 @@ struct pt_node_production : pt_node<Reader>
 //=== internal: pt_buffer ===//
 namespace lexy::_detail
 {
-// Basic stack allocator to store all the nodes of a tree.
+struct pt_pointer_block
+{
+    pt_pointer_block* next;
+};
+
 template <typename MemoryResource>
+using _detect_block_size = decltype(MemoryResource::block_size);
+
+// A memory resource can ask for bigger blocks.
+// The links of the compact layout rely on the fixed size.
+template <typename MemoryResource, typename Layout>
+constexpr std::size_t pt_block_size()
+{
+    if constexpr (pt_is_compact<Layout>)
+        return pt_compact_block::size;
+    else if constexpr (_detail::is_detected<_detect_block_size, MemoryResource>)
+        return MemoryResource::block_size;
+    else
+        return 4096;
+}
+
+// Basic stack allocator to store all the nodes of a tree.
+template <typename MemoryResource, typename Layout = parse_tree_pointer_layout>
 class pt_buffer
 {
     using resource_ptr = _detail::memory_resource_ptr<MemoryResource>;
+    using header
+        = std::conditional_t<pt_is_compact<Layout>, pt_compact_block, pt_pointer_block>;
 
-    static constexpr std::size_t block_size = 4096 - sizeof(void*);
+    static constexpr std::size_t block_size
+        = pt_block_size<MemoryResource, Layout>() - sizeof(header);
+    static constexpr std::size_t block_alignment
+        = pt_is_compact<Layout> ? pt_compact_block::size : alignof(header);
 
-    struct block
+    struct block : header
     {
-        block*        next;
         unsigned char memory[block_size];
 
         static block* allocate(resource_ptr resource)
         {
-            auto memory = resource->allocate(sizeof(block), alignof(block));
-            auto ptr    = ::new (memory) block; // Don't initialize array!
+            auto memory = resource->allocate(sizeof(block), block_alignment);
+            LEXY_ASSERT(reinterpret_cast<std::uintptr_t>(memory) % block_alignment == 0,
+                        "memory resource doesn't respect the alignment of the blocks");
+            auto ptr = ::new (memory) block; // Don't initialize array!
             ptr->next   = nullptr;
             return ptr;
         }
 
         static block* deallocate(resource_ptr resource, block* ptr)
         {
-            auto next = ptr->next;
-            resource->deallocate(ptr, sizeof(block), alignof(block));
+            auto next = ptr->next_block();
+            resource->deallocate(ptr, sizeof(block), block_alignment);
             return next;
         }
 
+        block* next_block() const noexcept
+        {
+            return static_cast<block*>(this->next);
+        }
+
         unsigned char* end() noexcept
         {
             return &memory[block_size];
         }
     };
+    static_assert(sizeof(block) == pt_block_size<MemoryResource, Layout>());
 
 public:
     //=== constructors/destructors/assignment ===//
     explicit constexpr pt_buffer(MemoryResource* resource) noexcept
-    : _resource(resource), _head(nullptr), _cur_block(nullptr), _cur_pos(nullptr)
+    : _resource(resource), _head(nullptr), _table(nullptr), _cur_block(nullptr), _cur_pos(nullptr)
     {}
 
     pt_buffer(pt_buffer&& other) noexcept
-    : _resource(other._resource), _head(other._head), _cur_block(other._cur_block),
-      _cur_pos(other._cur_pos)
+    : _resource(other._resource), _head(other._head), _table(other._table),
+      _cur_block(other._cur_block), _cur_pos(other._cur_pos)
     {
         other._head = other._cur_block = nullptr;
+        other._table                   = nullptr;
         other._cur_pos                 = nullptr;
     }
 
@@ -266,12 +595,20 @@ public:
         auto cur = _head;
         while (cur != nullptr)
             cur = block::deallocate(_resource, cur);
+
+        if (_table != nullptr)
+        {
+            _resource->deallocate(_table->blocks, _table->capacity * sizeof(pt_compact_block*),
+                                  alignof(pt_compact_block*));
+            _resource->deallocate(_table, sizeof(pt_block_table), alignof(pt_block_table));
+        }
     }
 
     pt_buffer& operator=(pt_buffer&& other) noexcept
     {
         lexy::_detail::swap(_resource, other._resource);
         lexy::_detail::swap(_head, other._head);
+        lexy::_detail::swap(_table, other._table);
         lexy::_detail::swap(_cur_block, other._cur_block);
         lexy::_detail::swap(_cur_pos, other._cur_pos);
         return *this;
@@ -286,20 +623,35 @@ public:
     void reset()
     {
         if (!_head)
-            _head = block::allocate(_resource);
+            _head = allocate_block();
 
         _cur_block = _head;
         _cur_pos   = &_cur_block->memory[0];
     }
 
+    // Sets the beginning of the input for the tokens of a compact tree.
+    void set_input(const void* input) noexcept
+    {
+        if constexpr (pt_is_compact<Layout>)
+            _table->input = input;
+        else
+            (void)input;
+    }
+
     void reserve(std::size_t size)
     {
         if (remaining_capacity() < size)
         {
-            auto next        = block::allocate(_resource);
-            _cur_block->next = next;
-            _cur_block       = next;
-            _cur_pos         = &_cur_block->memory[0];
+            // Re-use the blocks from before the last reset().
+            auto next = _cur_block->next_block();
+            if (next == nullptr)
+            {
+                next             = allocate_block();
+                _cur_block->next = next;
+            }
+
+            _cur_block = next;
+            _cur_pos   = &_cur_block->memory[0];
         }
     }
 
@@ -307,7 +659,7 @@ public:
     T* allocate(Args&&... args)
     {
         static_assert(std::is_trivially_copyable_v<T>);
-        static_assert(alignof(T) == alignof(void*));
+        static_assert(alignof(T) <= alignof(void*) && sizeof(T) % alignof(void*) == 0);
         LEXY_PRECONDITION(_cur_block);                        // Forgot to call .init().
         LEXY_PRECONDITION(remaining_capacity() >= sizeof(T)); // Forgot to call .reserve().
 
@@ -335,6 +687,49 @@ public:
     }
 
 private:
+    block* allocate_block()
+    {
+        if constexpr (pt_is_compact<Layout>)
+        {
+            if (_table == nullptr)
+            {
+                auto memory = _resource->allocate(sizeof(pt_block_table), alignof(pt_block_table));
+                _table      = ::new (memory) pt_block_table{nullptr, nullptr, 0, 0};
+            }
+
+            if (_table->size == _table->capacity)
+            {
+                // A link can't address more blocks, i.e. more than 4 GiB of nodes.
+                if (_table->capacity == pt_compact_block::max_blocks)
+                    throw std::bad_alloc();
+
+                auto capacity = _table->capacity == 0 ? 16 : 2 * _table->capacity;
+                auto memory   = _resource->allocate(capacity * sizeof(pt_compact_block*),
+                                                  alignof(pt_compact_block*));
+                auto blocks   = static_cast<pt_compact_block**>(memory);
+                for (auto i = std::size_t(0); i != _table->size; ++i)
+                    blocks[i] = _table->blocks[i];
+
+                if (_table->blocks != nullptr)
+                    _resource->deallocate(_table->blocks,
+                                          _table->capacity * sizeof(pt_compact_block*),
+                                          alignof(pt_compact_block*));
+                _table->blocks   = blocks;
+                _table->capacity = capacity;
+            }
+
+            auto result   = block::allocate(_resource);
+            result->table = _table;
+            result->index = _table->size;
+            _table->blocks[_table->size++] = result;
+            return result;
+        }
+        else
+        {
+            return block::allocate(_resource);
+        }
+    }
+
     std::size_t remaining_capacity() const noexcept
     {
         return std::size_t(_cur_block->end() - _cur_pos);
@@ -342,6 +737,7 @@ private:
 
     LEXY_EMPTY_MEMBER resource_ptr _resource;
     block*                         _head;
+    pt_block_table*                _table;
 
     block*         _cur_block;
     unsigned char* _cur_pos;
@@ -352,7 +748,8 @@ private:
 namespace lexy
 {
 template <typename Reader, typename TokenKind = void,
-          typename MemoryResource = _detail::default_memory_resource>
+          typename MemoryResource = _detail::default_memory_resource,
+          typename Layout         = parse_tree_pointer_layout>
 class parse_tree
 {
 public:
@@ -400,33 +797,73 @@ public:
     }
 
 private:
-    _detail::pt_buffer<MemoryResource>   _buffer;
-    _detail::pt_node_production<Reader>* _root;
+    _detail::pt_buffer<MemoryResource, Layout>   _buffer;
+    _detail::pt_node_production<Reader, Layout>* _root;
 };
 
 template <typename Input, typename TokenKind = void,
           typename MemoryResource = _detail::default_memory_resource>
 using parse_tree_for = lexy::parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResource>;
 
-template <typename Reader, typename TokenKind, typename MemoryResource>
-class parse_tree<Reader, TokenKind, MemoryResource>::builder
+template <typename Input, typename TokenKind = void,
+          typename MemoryResource = _detail::default_memory_resource>
+using compact_parse_tree_for = lexy::parse_tree<lexy::input_reader<Input>, TokenKind,
+                                                MemoryResource, parse_tree_compact_layout>;
+
+template <typename Input, typename TokenKind = void,
+          typename MemoryResource = _detail::default_memory_resource,
+          typename Layout         = parse_tree_pointer_layout>
+using hashed_parse_tree_for = lexy::parse_tree<lexy::input_reader<Input>, TokenKind,
+                                               MemoryResource, parse_tree_hashed_layout<Layout>>;
+
+/// Whether a parse tree of the input can use the `lexy::parse_tree_compact_layout`.
+/// It only checks the input; building a tree with more than 4 GiB of nodes throws
+/// `std::bad_alloc`.
+template <typename Input>
+constexpr bool fits_compact_parse_tree(const Input& input) noexcept
+{
+    if constexpr (std::is_pointer_v<typename lexy::input_reader<Input>::iterator>)
+        return std::size_t(input.end() - input.begin()) <= UINT_LEAST32_MAX;
+    else
+        return false;
+}
+
+template <typename Reader, typename TokenKind, typename MemoryResource, typename Layout>
+class parse_tree<Reader, TokenKind, MemoryResource, Layout>::builder
 {
+    using production_node = _detail::pt_node_production<Reader, Layout>;
+    using token_node      = _detail::pt_node_token<Reader, Layout>;
+
     struct state;
 
 public:
+    /// The tokens of a compact parse tree store offsets relative to `begin`,
+    /// which has to be the beginning of the input.
     template <typename Production>
-    explicit builder(parse_tree&& tree, Production production) : _result(LEXY_MOV(tree))
+    explicit builder(parse_tree&& tree, Production production, typename Reader::iterator begin)
+    : _result(LEXY_MOV(tree))
     {
         // Empty the initial parse tree.
         _result._buffer.reset();
+        _result._buffer.set_input(begin);
 
         // Allocate a new root node and begin construction there.
         // No need to reserve for the initial node.
-        _result._root
-            = _result._buffer.template allocate<_detail::pt_node_production<Reader>>(production);
-        _cur = state(_result._root);
+        _result._root = _result._buffer.template allocate<production_node>(production);
+        _cur          = state(_result._root);
     }
     template <typename Production>
+    explicit builder(Production production, typename Reader::iterator begin)
+    : builder(parse_tree(), production, begin)
+    {}
+
+    template <typename Production, typename L = Layout,
+              typename = std::enable_if_t<!_detail::pt_is_compact<L>>>
+    explicit builder(parse_tree&& tree, Production production)
+    : builder(LEXY_MOV(tree), production, typename Reader::iterator())
+    {}
+    template <typename Production, typename L = Layout,
+              typename = std::enable_if_t<!_detail::pt_is_compact<L>>>
     explicit builder(Production production) : builder(parse_tree(), production)
     {}
 
@@ -441,10 +878,8 @@ public:
 
         // Allocate a node for the production and append it to the current child list.
         // We reserve enough memory to allow for a trailing pointer.
-        _result._buffer.reserve(sizeof(_detail::pt_node_production<Reader>)
-                                + sizeof(_detail::pt_node_ptr<Reader>));
-        auto node
-            = _result._buffer.template allocate<_detail::pt_node_production<Reader>>(production);
+        _result._buffer.reserve(sizeof(production_node) + sizeof(_detail::pt_link<Reader, Layout>));
+        auto node = _result._buffer.template allocate<production_node>(production);
         // Note: don't append the node yet, we might still backtrack.
 
         // Subsequent insertions are to the new node, so update state and return old one.
@@ -471,10 +906,8 @@ public:
         else
         {
             // Allocate and append.
-            _result._buffer.reserve(sizeof(_detail::pt_node_token<Reader>));
-            auto node
-                = _result._buffer.template allocate<_detail::pt_node_token<Reader>>(kind, begin,
-                                                                                    end);
+            _result._buffer.reserve(sizeof(token_node));
+            auto node = _result._buffer.template allocate<token_node>(kind, begin, end);
             _cur.append(node);
         }
     }
@@ -517,13 +950,13 @@ private:
     struct state
     {
         // The current production all tokens are appended to.
-        _detail::pt_node_production<Reader>* prod = nullptr;
+        production_node* prod = nullptr;
         // The last child of the current production.
-        _detail::pt_node_ptr<Reader> last_child;
+        _detail::pt_node_ptr<Reader, Layout> last_child;
 
         state() = default;
 
-        explicit state(_detail::pt_node_production<Reader>* prod) : prod(prod) {}
+        explicit state(production_node* prod) : prod(prod) {}
 
         template <typename T>
         void append(T* child)
@@ -554,7 +987,8 @@ private:
                     // This only happens when a new block had to be started.
                     // In that case, we've saved enough space after the production to add a pointer.
                     auto memory = static_cast<void*>(prod + 1);
-                    ::new (memory) _detail::pt_node_ptr<Reader>(last_child);
+                    auto link   = ::new (memory) _detail::pt_link<Reader, Layout>();
+                    link->set(last_child);
 
                     prod->first_child_adjacent = false;
                 }
@@ -566,12 +1000,16 @@ private:
             if (last_child)
                 // The pointer of the last child needs to point back to prod.
                 last_child.base()->ptr.set_parent(prod);
+
+            if constexpr (_detail::pt_is_hashed<Layout>)
+                // All children are finished, so we can combine their hashes.
+                prod->set_hash(prod->compute_hash());
         }
     } _cur;
 };
 
-template <typename Reader, typename TokenKind, typename MemoryResource>
-class parse_tree<Reader, TokenKind, MemoryResource>::node_kind
+template <typename Reader, typename TokenKind, typename MemoryResource, typename Layout>
+class parse_tree<Reader, TokenKind, MemoryResource, Layout>::node_kind
 {
 public:
     bool is_token() const noexcept
@@ -586,7 +1024,7 @@ public:
     bool is_root() const noexcept
     {
         // Root node has no next pointer.
-        return !_ptr.base()->ptr;
+        return !_ptr.base()->ptr.get();
     }
     bool is_token_production() const noexcept
     {
@@ -669,15 +1107,15 @@ public:
     }
 
 private:
-    explicit node_kind(_detail::pt_node_ptr<Reader> ptr) : _ptr(ptr) {}
+    explicit node_kind(_detail::pt_node_ptr<Reader, Layout> ptr) : _ptr(ptr) {}
 
-    _detail::pt_node_ptr<Reader> _ptr;
+    _detail::pt_node_ptr<Reader, Layout> _ptr;
 
     friend parse_tree::node;
 };
 
-template <typename Reader, typename TokenKind, typename MemoryResource>
-class parse_tree<Reader, TokenKind, MemoryResource>::node
+template <typename Reader, typename TokenKind, typename MemoryResource, typename Layout>
+class parse_tree<Reader, TokenKind, MemoryResource, Layout>::node
 {
 public:
     void* address() const noexcept
@@ -697,9 +1135,9 @@ public:
             return *this;
 
         // If we follow the sibling pointer, we reach a parent pointer.
-        auto cur = _ptr.base()->ptr;
+        auto cur = _ptr.base()->ptr.get();
         while (cur.is_sibling_ptr())
-            cur = cur.base()->ptr;
+            cur = cur.base()->ptr.get();
         return node(cur);
     }
 
@@ -724,7 +1162,7 @@ public:
             void increment() noexcept
             {
                 LEXY_PRECONDITION(*this != sentinel{});
-                _cur = _cur.base()->ptr;
+                _cur = _cur.base()->ptr.get();
             }
 
             bool equal(iterator rhs) const noexcept
@@ -740,9 +1178,9 @@ public:
             }
 
         private:
-            explicit iterator(_detail::pt_node_ptr<Reader> ptr) noexcept : _cur(ptr) {}
+            explicit iterator(_detail::pt_node_ptr<Reader, Layout> ptr) noexcept : _cur(ptr) {}
 
-            _detail::pt_node_ptr<Reader> _cur;
+            _detail::pt_node_ptr<Reader, Layout> _cur;
 
             friend children_range;
         };
@@ -767,11 +1205,11 @@ public:
         }
 
     private:
-        explicit children_range(_detail::pt_node_ptr<Reader> begin, std::size_t count)
+        explicit children_range(_detail::pt_node_ptr<Reader, Layout> begin, std::size_t count)
         : _begin(begin), _count(count)
         {}
 
-        _detail::pt_node_ptr<Reader> _begin;
+        _detail::pt_node_ptr<Reader, Layout> _begin;
         std::size_t                  _count;
 
         friend node;
@@ -782,7 +1220,7 @@ public:
         if (auto prod = _ptr.production())
             return children_range(prod->first_child(), prod->child_count);
         else
-            return children_range(_detail::pt_node_ptr<Reader>{}, 0);
+            return children_range(_detail::pt_node_ptr<Reader, Layout>{}, 0);
     }
 
     class sibling_range
@@ -800,12 +1238,12 @@ public:
 
             void increment() noexcept
             {
-                if (_cur.base()->ptr.is_parent_ptr())
+                if (_cur.base()->ptr.get().is_parent_ptr())
                     // We're pointing to the parent, go to first child instead.
-                    _cur = _cur.base()->ptr.production()->first_child();
+                    _cur = _cur.base()->ptr.get().production()->first_child();
                 else
                     // We're pointing to a sibling, go there.
-                    _cur = _cur.base()->ptr;
+                    _cur = _cur.base()->ptr.get();
             }
 
             bool equal(iterator rhs) const noexcept
@@ -814,9 +1252,9 @@ public:
             }
 
         private:
-            explicit iterator(_detail::pt_node_ptr<Reader> ptr) noexcept : _cur(ptr) {}
+            explicit iterator(_detail::pt_node_ptr<Reader, Layout> ptr) noexcept : _cur(ptr) {}
 
-            _detail::pt_node_ptr<Reader> _cur;
+            _detail::pt_node_ptr<Reader, Layout> _cur;
 
             friend sibling_range;
         };
@@ -839,9 +1277,9 @@ public:
         }
 
     private:
-        explicit sibling_range(_detail::pt_node_ptr<Reader> node) noexcept : _node(node) {}
+        explicit sibling_range(_detail::pt_node_ptr<Reader, Layout> node) noexcept : _node(node) {}
 
-        _detail::pt_node_ptr<Reader> _node;
+        _detail::pt_node_ptr<Reader, Layout> _node;
 
         friend node;
     };
@@ -854,13 +1292,13 @@ public:
     bool is_last_child() const noexcept
     {
         // We're the last child if our pointer points to the parent.
-        return _ptr.base()->ptr.is_parent_ptr();
+        return _ptr.base()->ptr.get().is_parent_ptr();
     }
 
     auto lexeme() const noexcept
     {
         if (auto token = _ptr.token())
-            return lexy::lexeme<Reader>(token->begin, token->end());
+            return lexy::lexeme<Reader>(token->begin(), token->end());
         else
             return lexy::lexeme<Reader>();
     }
@@ -871,7 +1309,18 @@ public:
 
         auto token = _ptr.token();
         auto kind  = token_kind<TokenKind>::from_raw(token->kind);
-        return lexy::token<Reader, TokenKind>(kind, token->begin, token->end());
+        return lexy::token<Reader, TokenKind>(kind, token->begin(), token->end());
+    }
+
+    std::uint_least64_t subtree_hash() const noexcept
+    {
+        static_assert(_detail::pt_is_hashed<Layout>,
+                      "subtree hashes require a lexy::parse_tree_hashed_layout");
+
+        if (auto prod = _ptr.production())
+            return prod->hash();
+        else
+            return _ptr.token()->hash();
     }
 
     friend bool operator==(node lhs, node rhs) noexcept
@@ -884,14 +1333,14 @@ public:
     }
 
 private:
-    explicit node(_detail::pt_node_ptr<Reader> ptr) noexcept : _ptr(ptr) {}
-    explicit node(_detail::pt_node_production<Reader>* ptr) noexcept
+    explicit node(_detail::pt_node_ptr<Reader, Layout> ptr) noexcept : _ptr(ptr) {}
+    explicit node(_detail::pt_node_production<Reader, Layout>* ptr) noexcept
     {
         // It doesn't matter whether the pointer is a parent or sibling.
         _ptr.set_parent(ptr);
     }
 
-    _detail::pt_node_ptr<Reader> _ptr;
+    _detail::pt_node_ptr<Reader, Layout> _ptr;
 
     friend parse_tree;
 };
@@ -906,8 +1355,8 @@ enum class traverse_event
     leaf,
 };
 
-template <typename Reader, typename TokenKind, typename MemoryResource>
-class parse_tree<Reader, TokenKind, MemoryResource>::traverse_range
+template <typename Reader, typename TokenKind, typename MemoryResource, typename Layout>
+class parse_tree<Reader, TokenKind, MemoryResource, Layout>::traverse_range
 {
 public:
     struct _value_type
@@ -952,7 +1401,7 @@ public:
             if (_cur.token())
                 // We're currently pointing to a token.
                 // Continue with its sibling.
-                _cur = _cur.base()->ptr;
+                _cur = _cur.base()->ptr.get();
             else if (_cur.is_sibling_ptr())
                 // We're currently pointing to a production for the first time.
                 // Continue to the first child.
@@ -960,7 +1409,7 @@ public:
             else if (_cur.is_parent_ptr())
                 // We're currently pointing back to the parent production.
                 // We continue with its sibling.
-                _cur = _cur.base()->ptr;
+                _cur = _cur.base()->ptr.get();
             else
                 LEXY_ASSERT(false, "unreachable");
         }
@@ -973,7 +1422,7 @@ public:
         }
 
     private:
-        _detail::pt_node_ptr<Reader> _cur;
+        _detail::pt_node_ptr<Reader, Layout> _cur;
     };
 
     bool empty() const noexcept
@@ -1052,7 +1501,7 @@ public:
     {
         if (_depth++ == 0)
         {
-            _builder.emplace(LEXY_MOV(*_tree), prod);
+            _builder.emplace(LEXY_MOV(*_tree), prod, pos);
             return {{}, pos};
         }
         else
@@ -1098,9 +1547,9 @@ private:
     lexy::validate_handler<Input, Callback> _validate;
 };
 
-template <typename Production, typename TokenKind, typename MemoryResource, typename Input,
-          typename ErrorCallback>
-auto parse_as_tree(parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResource>& tree,
+template <typename Production, typename TokenKind, typename MemoryResource, typename Layout,
+          typename Input, typename ErrorCallback>
+auto parse_as_tree(parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResource, Layout>& tree,
                    const Input& input, const ErrorCallback& callback)
     -> validate_result<ErrorCallback>
 {
@@ -0,0 +1,92 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_SIMD_HPP_INCLUDED
+#define LEXY_SIMD_HPP_INCLUDED
+
+#include <cstddef>
+#include <lexy/_detail/config.hpp>
+
+namespace lexy
+{
+/// The instruction set extensions the vectorized kernels use, in increasing order.
+enum class simd_level
+{
+    scalar,
+    sse2,
+    sse4_2,
+    avx2,
+    avx512,
+};
+} // namespace lexy
+
+namespace lexy::_detail
+{
+// The kernels use the level selected by `simd_select_level()`, or the supported level.
+// They are dispatched through a table that is resolved on the first call.
+//
+// Do not change ABI, especially with different build configurations!
+simd_level simd_supported_level() noexcept;
+simd_level simd_active_level() noexcept;
+simd_level simd_select_level(simd_level level) noexcept;
+
+const char* simd_find_non_ascii(const char* begin, const char* end) noexcept;
+const char* simd_find_invalid_utf8(const char* begin, const char* end) noexcept;
+std::size_t simd_count_newlines(const char* begin, const char* end) noexcept;
+void        simd_byte_swap16(char16_t* data, std::size_t size) noexcept;
+void        simd_byte_swap32(char32_t* data, std::size_t size) noexcept;
+} // namespace lexy::_detail
+
+namespace lexy
+{
+/// The highest level the CPU and OS support.
+inline simd_level supported_simd_level() noexcept
+{
+    return _detail::simd_supported_level();
+}
+
+/// The level the kernels currently use.
+inline simd_level active_simd_level() noexcept
+{
+    return _detail::simd_active_level();
+}
+
+/// Makes the kernels use the given level, or the supported one if it is lower.
+/// Returns the level that is used now.
+inline simd_level set_simd_level(simd_level level) noexcept
+{
+    return _detail::simd_select_level(level);
+}
+
+/// Returns a pointer to the first byte in the range that isn't ASCII, or `end`.
+inline const char* find_non_ascii(const char* begin, const char* end) noexcept
+{
+    return _detail::simd_find_non_ascii(begin, end);
+}
+
+/// Returns a pointer to the first byte of the first ill-formed UTF-8 sequence, or `end`.
+inline const char* find_invalid_utf8(const char* begin, const char* end) noexcept
+{
+    return _detail::simd_find_invalid_utf8(begin, end);
+}
+
+/// Returns the number of `\n` in the range.
+inline std::size_t count_newlines(const char* begin, const char* end) noexcept
+{
+    return _detail::simd_count_newlines(begin, end);
+}
+
+/// Reverses the bytes of each code unit in place.
+inline void byte_swap(char16_t* data, std::size_t size) noexcept
+{
+    _detail::simd_byte_swap16(data, size);
+}
+inline void byte_swap(char32_t* data, std::size_t size) noexcept
+{
+    _detail::simd_byte_swap32(data, size);
+}
+} // namespace lexy
+
+#endif // LEXY_SIMD_HPP_INCLUDED
+
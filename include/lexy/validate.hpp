@@ -40,6 +40,10 @@ constexpr auto _get_error_sink(const Callback& callback)
 template <typename Callback>
 using _error_sink_t = decltype(_get_error_sink(LEXY_DECLVAL(Callback)));
 
+/// An error callback that stores each error as a `lexy::compact_error` in the container.
+template <typename Container>
+constexpr auto collect_compact = collect<Container>(construct<typename Container::value_type>);
+
 template <typename ErrorCallback>
 class validate_result
 {
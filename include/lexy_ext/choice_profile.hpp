@@ -0,0 +1,50 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_EXT_CHOICE_PROFILE_HPP_INCLUDED
+#define LEXY_EXT_CHOICE_PROFILE_HPP_INCLUDED
+
+#include <cstdio>
+#include <lexy/dsl/profiled_choice.hpp>
+
+#if !LEXY_CHOICE_STATISTICS
+#    error "choice statistics are only collected if LEXY_CHOICE_STATISTICS is enabled"
+#endif
+
+namespace lexy_ext
+{
+/// Writes the statistics of all profiled choices as a header that specializes
+/// `lexy::choice_profile`. It has to be included after the tags are declared, but before the
+/// grammar is defined.
+inline void write_choice_profile(std::FILE* file)
+{
+    std::fputs("// Generated by lexy_ext::write_choice_profile().\n", file);
+    std::fputs("#include <lexy/dsl/profiled_choice.hpp>\n", file);
+
+    for (auto stats = lexy::choice_statistics::first(); stats; stats = stats->next())
+    {
+        std::fprintf(file, "\ntemplate <>\nstruct lexy::choice_profile<%s>\n{\n", stats->tag_name());
+
+        std::fputs("    // misses: ", file);
+        for (auto i = std::size_t(0); i != stats->alternatives(); ++i)
+            std::fprintf(file, "%s%llu", i == 0 ? "" : ", ",
+                         static_cast<unsigned long long>(stats->misses(i)));
+
+        std::fputs("\n    static constexpr std::uint64_t hits[] = {", file);
+        for (auto i = std::size_t(0); i != stats->alternatives(); ++i)
+            std::fprintf(file, "%s%llu", i == 0 ? "" : ", ",
+                         static_cast<unsigned long long>(stats->hits(i)));
+        std::fputs("};\n};\n", file);
+    }
+}
+
+/// Resets the statistics of all profiled choices.
+inline void reset_choice_statistics()
+{
+    for (auto stats = lexy::choice_statistics::first(); stats; stats = stats->next())
+        stats->reset();
+}
+} // namespace lexy_ext
+
+#endif // LEXY_EXT_CHOICE_PROFILE_HPP_INCLUDED
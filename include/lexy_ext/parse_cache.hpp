@@ -0,0 +1,410 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_EXT_PARSE_CACHE_HPP_INCLUDED
+#define LEXY_EXT_PARSE_CACHE_HPP_INCLUDED
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <lexy/_detail/detect.hpp>
+#include <lexy/_detail/lazy_init.hpp>
+#include <lexy/input/file.hpp>
+#include <lexy/parse.hpp>
+
+namespace lexy_ext
+{
+/// A fast non-cryptographic 64-bit hash, which processes eight bytes at a time.
+inline std::uint64_t hash_bytes(const void* data, std::size_t size, std::uint64_t seed = 0) noexcept
+{
+    constexpr auto multiplier = std::uint64_t(0x9E3779B97F4A7C15);
+    auto           mix        = [](std::uint64_t h) {
+        h ^= h >> 30;
+        h *= std::uint64_t(0xBF58476D1CE4E5B9);
+        h ^= h >> 27;
+        h *= std::uint64_t(0x94D049BB133111EB);
+        h ^= h >> 31;
+        return h;
+    };
+
+    auto bytes = static_cast<const unsigned char*>(data);
+    auto hash  = seed ^ (size * multiplier);
+    for (; size >= 8; bytes += 8, size -= 8)
+    {
+        std::uint64_t word;
+        std::memcpy(&word, bytes, 8);
+        hash = (hash ^ mix(word)) * multiplier;
+    }
+    if (size > 0)
+    {
+        std::uint64_t word = 0;
+        std::memcpy(&word, bytes, size);
+        hash = (hash ^ mix(word)) * multiplier;
+    }
+    return mix(hash);
+}
+
+struct parse_cache_options
+{
+    /// The maximal number of entries in the directory; the least recently used ones are evicted.
+    std::size_t max_entries = 1024;
+    /// Whether new entries are written by a background thread, one after the other.
+    bool background_store = true;
+    /// Mixed into every key, change it when the grammar or the serialization format changes.
+    std::string version;
+};
+
+/// A directory of serialized parse results, keyed by a hash of the input.
+///
+/// Each entry is a single file; its modification time is updated on every hit, so the entries
+/// with the oldest one are evicted first. Entries are written to a temporary file with a name
+/// unique to the cache object and then renamed, so multiple processes can share a directory.
+class parse_cache
+{
+public:
+    explicit parse_cache(std::filesystem::path directory, parse_cache_options options = {})
+    : _directory(LEXY_MOV(directory)), _options(LEXY_MOV(options)),
+      _seed(hash_bytes(_options.version.data(), _options.version.size())),
+      _tmp_extension(_unique_tmp_extension(this))
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(_directory, ec);
+    }
+
+    parse_cache(const parse_cache&) = delete;
+    parse_cache& operator=(const parse_cache&) = delete;
+
+    ~parse_cache()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_queue_mutex);
+            _stop = true;
+        }
+        _queue_cv.notify_one();
+
+        // The worker writes the remaining entries before it stops.
+        if (_worker.joinable())
+            _worker.join();
+    }
+
+    /// The key of the input bytes for the given production.
+    std::uint64_t key(const char* production, const void* data, std::size_t size) const noexcept
+    {
+        auto seed = hash_bytes(production, std::strlen(production), _seed);
+        return hash_bytes(data, size, seed);
+    }
+
+    /// Invokes `fn(data, size)` with the stored data of the key and returns true, if there is any.
+    /// The input size is stored alongside the data to detect collisions.
+    template <typename Fn>
+    bool lookup(std::uint64_t key, std::size_t input_size, Fn fn) const
+    {
+        auto path = _entry_path(key);
+        auto file = lexy::read_file<lexy::byte_encoding>(path.string().c_str());
+        if (!file || file.size() < _header_size)
+            return false;
+
+        auto data = file.data();
+        if (std::memcmp(data, _magic, sizeof(_magic)) != 0)
+            return false;
+        std::uint64_t stored_size;
+        std::memcpy(&stored_size, data + sizeof(_magic), sizeof(stored_size));
+        if (stored_size != input_size)
+            return false;
+
+        // Mark the entry as recently used.
+        std::error_code ec;
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+
+        fn(data + _header_size, file.size() - _header_size);
+        return true;
+    }
+
+    /// Stores the data for the key, possibly in the background.
+    void store(std::uint64_t key, std::size_t input_size, std::string data)
+    {
+        if (!_options.background_store)
+        {
+            _write(key, input_size, data);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_queue_mutex);
+            _queue.push_back({key, input_size, LEXY_MOV(data)});
+            if (!_worker.joinable())
+                _worker = std::thread([this] { _work(); });
+        }
+        _queue_cv.notify_one();
+    }
+
+    /// Waits until all entries are written.
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(_queue_mutex);
+        _idle_cv.wait(lock, [&] { return _queue.empty() && !_busy; });
+    }
+
+private:
+    static constexpr char        _magic[8]    = {'l', 'e', 'x', 'y', 'c', 'c', 'h', '1'};
+    static constexpr std::size_t _header_size = sizeof(_magic) + sizeof(std::uint64_t);
+    static constexpr auto        _extension   = ".lexy-cache";
+
+    struct _job
+    {
+        std::uint64_t key;
+        std::size_t   input_size;
+        std::string   data;
+    };
+
+    // The random device alone need not be random, so mix in the time and address as well.
+    static std::string _unique_tmp_extension(const void* object)
+    {
+        auto now     = std::chrono::steady_clock::now().time_since_epoch().count();
+        auto address = std::uint64_t(reinterpret_cast<std::uintptr_t>(object));
+        auto value   = hash_bytes(&now, sizeof(now), address ^ std::random_device()());
+
+        char result[22];
+        std::snprintf(result, sizeof(result), ".tmp%016llx",
+                      static_cast<unsigned long long>(value));
+        return result;
+    }
+
+    void _work()
+    {
+        std::unique_lock<std::mutex> lock(_queue_mutex);
+        while (true)
+        {
+            _queue_cv.wait(lock, [&] { return _stop || !_queue.empty(); });
+            if (_queue.empty())
+                // We're stopping and everything has been written.
+                break;
+
+            auto job = LEXY_MOV(_queue.front());
+            _queue.pop_front();
+            _busy = true;
+
+            lock.unlock();
+            _write(job.key, job.input_size, job.data);
+            lock.lock();
+
+            _busy = false;
+            if (_queue.empty())
+                _idle_cv.notify_all();
+        }
+    }
+
+    std::filesystem::path _entry_path(std::uint64_t key) const
+    {
+        char name[17];
+        std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(key));
+        return _directory / (std::string(name) + _extension);
+    }
+
+    void _write(std::uint64_t key, std::size_t input_size, const std::string& data)
+    {
+        auto path = _entry_path(key);
+        auto tmp  = path;
+        tmp += _tmp_extension + "-" + std::to_string(_tmp_counter++);
+
+        auto file = std::fopen(tmp.string().c_str(), "wb");
+        if (!file)
+            return;
+
+        auto size = static_cast<std::uint64_t>(input_size);
+        auto ok   = std::fwrite(_magic, sizeof(_magic), 1, file) == 1
+                  && std::fwrite(&size, sizeof(size), 1, file) == 1
+                  && std::fwrite(data.data(), 1, data.size(), file) == data.size();
+        ok = std::fclose(file) == 0 && ok;
+
+        std::error_code ec;
+        if (ok)
+            std::filesystem::rename(tmp, path, ec);
+        if (!ok || ec)
+        {
+            std::filesystem::remove(tmp, ec);
+            return;
+        }
+
+        _evict();
+    }
+
+    void _evict()
+    {
+        std::lock_guard<std::mutex> lock(_evict_mutex);
+
+        struct entry
+        {
+            std::filesystem::file_time_type time;
+            std::filesystem::path           path;
+        };
+        std::vector<entry> entries;
+
+        std::error_code ec;
+        for (auto iter = std::filesystem::directory_iterator(_directory, ec);
+             !ec && iter != std::filesystem::directory_iterator(); iter.increment(ec))
+        {
+            if (iter->path().extension() != _extension)
+                continue;
+
+            auto time = iter->last_write_time(ec);
+            if (!ec)
+                entries.push_back({time, iter->path()});
+        }
+        if (entries.size() <= _options.max_entries)
+            return;
+
+        auto excess = entries.size() - _options.max_entries;
+        std::partial_sort(entries.begin(), entries.begin() + std::ptrdiff_t(excess), entries.end(),
+                          [](const entry& lhs, const entry& rhs) { return lhs.time < rhs.time; });
+        for (auto i = std::size_t(0); i != excess; ++i)
+            std::filesystem::remove(entries[i].path, ec);
+    }
+
+    std::filesystem::path _directory;
+    parse_cache_options   _options;
+    std::uint64_t         _seed;
+    std::string           _tmp_extension;
+    std::atomic<unsigned> _tmp_counter{0};
+    std::mutex            _evict_mutex;
+
+    std::mutex              _queue_mutex;
+    std::condition_variable _queue_cv;
+    std::condition_variable _idle_cv;
+    std::deque<_job>        _queue;
+    bool                    _busy = false;
+    bool                    _stop = false;
+    std::thread             _worker;
+};
+} // namespace lexy_ext
+
+namespace lexy_ext
+{
+#if 0
+/// Serializes the values of `cached_parse()`.
+class Codec
+{
+    using value_type = ...;
+
+    /// Appends the serialized value to the string.
+    void save(const value_type& value, std::string& out) const;
+    /// Deserializes the value, returns an empty optional if the data is invalid.
+    std::optional<value_type> load(const unsigned char* data, std::size_t size) const;
+};
+#endif
+
+/// The result of `cached_parse()`.
+template <typename T, typename ErrorCallback>
+class cached_parse_result
+{
+public:
+    using value_type   = T;
+    using parse_result = lexy::parse_result<T, ErrorCallback>;
+
+    /// Whether the value was loaded from the cache, so the input wasn't parsed at all.
+    bool is_cached() const noexcept
+    {
+        return static_cast<bool>(_cached);
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return is_cached() || _result->is_success();
+    }
+
+    bool has_value() const noexcept
+    {
+        return is_cached() || _result->has_value();
+    }
+    const T& value() const& noexcept
+    {
+        return is_cached() ? *_cached : _result->value();
+    }
+    T&& value() && noexcept
+    {
+        return is_cached() ? LEXY_MOV(*_cached) : LEXY_MOV(*_result).value();
+    }
+
+    /// The result of parsing the input; only available if the value wasn't cached.
+    const parse_result& result() const& noexcept
+    {
+        LEXY_PRECONDITION(!is_cached());
+        return *_result;
+    }
+    parse_result&& result() && noexcept
+    {
+        LEXY_PRECONDITION(!is_cached());
+        return LEXY_MOV(*_result);
+    }
+
+private:
+    lexy::_detail::lazy_init<T>            _cached;
+    lexy::_detail::lazy_init<parse_result> _result;
+
+    template <typename Production, typename Input, typename Codec, typename Callback>
+    friend auto cached_parse(parse_cache&, const Input&, const Codec&, Callback)
+        -> cached_parse_result<typename Codec::value_type, Callback>;
+};
+
+template <typename Input>
+using _detect_input_data = decltype(LEXY_DECLVAL(const Input&).data(),
+                                    LEXY_DECLVAL(const Input&).size());
+
+/// Parses the production into a value, unless the cache already has the value of the same input.
+/// The value of a successful parse is stored in the cache.
+///
+/// The input must be contiguous memory, like a `lexy::buffer` or the result of `lexy::read_file`.
+template <typename Production, typename Input, typename Codec, typename Callback>
+auto cached_parse(parse_cache& cache, const Input& input, const Codec& codec, Callback callback)
+    -> cached_parse_result<typename Codec::value_type, Callback>
+{
+    using value_type = typename Codec::value_type;
+    cached_parse_result<value_type, Callback> result;
+
+    const void* data;
+    std::size_t size;
+    if constexpr (lexy::_detail::is_detected<_detect_input_data, Input>)
+    {
+        data = input.data();
+        size = input.size() * sizeof(*input.data());
+    }
+    else
+    {
+        data = input.begin();
+        size = lexy::_detail::range_size(input.begin(), input.end()) * sizeof(*input.begin());
+    }
+
+    auto key = cache.key(lexy::production_name<Production>(), data, size);
+    cache.lookup(key, size, [&](const unsigned char* stored, std::size_t stored_size) {
+        if (auto value = codec.load(stored, stored_size))
+            result._cached.emplace(LEXY_MOV(*value));
+    });
+    if (result.is_cached())
+        return result;
+
+    result._result.emplace(lexy::parse<Production>(input, LEXY_MOV(callback)));
+    if (result._result->is_success())
+    {
+        std::string serialized;
+        codec.save(result._result->value(), serialized);
+        cache.store(key, size, LEXY_MOV(serialized));
+    }
+    return result;
+}
+} // namespace lexy_ext
+
+#endif // LEXY_EXT_PARSE_CACHE_HPP_INCLUDED
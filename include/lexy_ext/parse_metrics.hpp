@@ -0,0 +1,616 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_EXT_PARSE_METRICS_HPP_INCLUDED
+#define LEXY_EXT_PARSE_METRICS_HPP_INCLUDED
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <lexy/parse.hpp>
+#include <lexy/validate.hpp>
+
+namespace lexy_ext
+{
+/// The upper bounds of the buckets of the latency histograms, in seconds.
+inline constexpr double parse_latency_buckets[] = {1e-6, 1e-5, 1e-4, 1e-3, 1e-2, 1e-1, 1, 10};
+/// The upper bounds of the buckets of the throughput histograms, in bytes per second.
+inline constexpr double parse_throughput_buckets[] = {1e6, 1e7, 1e8, 1e9, 1e10};
+
+constexpr auto _latency_bucket_count    = std::size(parse_latency_buckets) + 1;
+constexpr auto _throughput_bucket_count = std::size(parse_throughput_buckets) + 1;
+
+template <std::size_t N>
+std::size_t _bucket_of(const double (&bounds)[N], double value)
+{
+    // The last bucket is the implicit +Inf one.
+    return std::size_t(std::lower_bound(bounds, bounds + N, value) - bounds);
+}
+
+// Only ever written by the thread that owns the shard, so we don't need a read-modify-write.
+template <typename T>
+void _add(std::atomic<T>& counter, T value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+// The metrics of one production on one thread.
+struct _production_metrics
+{
+    std::atomic<const char*>   name{nullptr};
+    std::atomic<std::uint64_t> parses{0}, bytes{0};
+    std::atomic<std::uint64_t> successes{0}, recovered_errors{0}, fatal_errors{0};
+    std::atomic<std::uint64_t> latency_ns{0};
+    std::atomic<double>        throughput{0};
+    std::atomic<std::uint64_t> latency_buckets[_latency_bucket_count]       = {};
+    std::atomic<std::uint64_t> throughput_buckets[_throughput_bucket_count] = {};
+};
+
+// The number of errors with one tag raised while parsing one production on one thread.
+struct _error_metrics
+{
+    std::atomic<const char*>   production{nullptr};
+    std::atomic<const char*>   tag{nullptr};
+    std::atomic<std::uint64_t> count{0};
+};
+
+// All metrics of one thread.
+// The tables are fixed size and only grow, so they can be read concurrently without a lock.
+class _metrics_shard
+{
+public:
+    static constexpr std::size_t max_productions = 32;
+    static constexpr std::size_t max_errors      = 64;
+
+    explicit _metrics_shard(std::thread::id owner) : _owner(owner), _next(nullptr) {}
+
+    _production_metrics& production(const char* name)
+    {
+        auto hash = std::hash<const char*>{}(name);
+        for (auto i = std::size_t(0); i != max_productions; ++i)
+        {
+            auto& entry = _productions[(hash + i) % max_productions];
+
+            auto cur = entry.name.load(std::memory_order_relaxed);
+            if (cur == name)
+                return entry;
+            else if (cur == nullptr)
+            {
+                entry.name.store(name, std::memory_order_release);
+                return entry;
+            }
+        }
+
+        // The table is full, so we use the overflow entry.
+        _overflow.name.store(_other_tag, std::memory_order_release);
+        return _overflow;
+    }
+
+    void error(const char* production, const char* tag)
+    {
+        auto hash = std::hash<const char*>{}(production) ^ std::hash<const char*>{}(tag);
+        for (auto i = std::size_t(0); i != max_errors; ++i)
+        {
+            auto& entry = _errors[(hash + i) % max_errors];
+
+            auto cur = entry.tag.load(std::memory_order_relaxed);
+            if (cur == nullptr)
+            {
+                // Publish the production before the tag, which marks the entry as used.
+                entry.production.store(production, std::memory_order_relaxed);
+                entry.tag.store(tag, std::memory_order_release);
+            }
+            else if (cur != tag || entry.production.load(std::memory_order_relaxed) != production)
+                continue;
+
+            _add(entry.count, std::uint64_t(1));
+            return;
+        }
+
+        // The table is full, so we count it as an unknown tag, if there is still room for it.
+        if (tag != _other_tag)
+            error(production, _other_tag);
+    }
+
+    template <typename Fn>
+    void for_each_production(Fn fn) const
+    {
+        for (auto& entry : _productions)
+            if (auto name = entry.name.load(std::memory_order_acquire))
+                fn(name, entry);
+        if (auto name = _overflow.name.load(std::memory_order_acquire))
+            fn(name, _overflow);
+    }
+
+    template <typename Fn>
+    void for_each_error(Fn fn) const
+    {
+        for (auto& entry : _errors)
+            if (auto tag = entry.tag.load(std::memory_order_acquire))
+                fn(entry.production.load(std::memory_order_relaxed), tag,
+                   entry.count.load(std::memory_order_relaxed));
+    }
+
+private:
+    static constexpr const char* _other_tag = "(other)";
+
+    _production_metrics _productions[max_productions];
+    _production_metrics _overflow;
+    _error_metrics      _errors[max_errors];
+
+    std::thread::id _owner;
+    _metrics_shard* _next;
+
+    friend class parse_metrics;
+};
+} // namespace lexy_ext
+
+namespace lexy_ext
+{
+/// The metrics aggregated over all threads, as returned by `parse_metrics::snapshot()`.
+struct parse_metrics_snapshot
+{
+    struct production_metrics
+    {
+        std::string   production;
+        std::uint64_t parses           = 0;
+        std::uint64_t bytes            = 0;
+        std::uint64_t successes        = 0;
+        std::uint64_t recovered_errors = 0;
+        std::uint64_t fatal_errors     = 0;
+
+        /// The sum of all latencies, in seconds, and the number of parses per bucket.
+        double        latency_sum                            = 0;
+        std::uint64_t latency_buckets[_latency_bucket_count] = {};
+        /// The sum of all throughputs, in bytes per second, and the number of parses per bucket.
+        double        throughput_sum                               = 0;
+        std::uint64_t throughput_buckets[_throughput_bucket_count] = {};
+    };
+
+    struct error_metrics
+    {
+        std::string   production;
+        std::string   tag;
+        std::uint64_t count = 0;
+    };
+
+    /// Sorted by production name.
+    std::vector<production_metrics> productions;
+    /// Sorted by production name and tag.
+    std::vector<error_metrics> errors;
+};
+
+/// Collects metrics of all parses done with `parse_with_metrics()` or `validate_with_metrics()`.
+/// Every thread records into its own shard without locking; `snapshot()` aggregates them.
+class parse_metrics
+{
+public:
+    parse_metrics() : _id(_next_id().fetch_add(1, std::memory_order_relaxed)), _shards(nullptr) {}
+
+    parse_metrics(const parse_metrics&) = delete;
+    parse_metrics& operator=(const parse_metrics&) = delete;
+
+    ~parse_metrics()
+    {
+        auto shard = _shards.load(std::memory_order_acquire);
+        while (shard)
+        {
+            auto next = shard->_next;
+            delete shard;
+            shard = next;
+        }
+    }
+
+    /// Aggregates the metrics recorded so far by all threads.
+    /// It can be called concurrently with parsing, but may miss parses that are in progress.
+    parse_metrics_snapshot snapshot() const
+    {
+        parse_metrics_snapshot result;
+
+        for (auto shard = _shards.load(std::memory_order_acquire); shard; shard = shard->_next)
+        {
+            shard->for_each_production([&](const char* name, const _production_metrics& entry) {
+                auto iter = std::find_if(result.productions.begin(), result.productions.end(),
+                                         [&](auto& p) { return p.production == name; });
+                if (iter == result.productions.end())
+                {
+                    result.productions.emplace_back();
+                    iter             = std::prev(result.productions.end());
+                    iter->production = name;
+                }
+
+                auto load = [](auto& counter) { return counter.load(std::memory_order_relaxed); };
+                iter->parses += load(entry.parses);
+                iter->bytes += load(entry.bytes);
+                iter->successes += load(entry.successes);
+                iter->recovered_errors += load(entry.recovered_errors);
+                iter->fatal_errors += load(entry.fatal_errors);
+
+                iter->latency_sum += double(load(entry.latency_ns)) / 1e9;
+                for (auto i = std::size_t(0); i != _latency_bucket_count; ++i)
+                    iter->latency_buckets[i] += load(entry.latency_buckets[i]);
+
+                iter->throughput_sum += load(entry.throughput);
+                for (auto i = std::size_t(0); i != _throughput_bucket_count; ++i)
+                    iter->throughput_buckets[i] += load(entry.throughput_buckets[i]);
+            });
+
+            shard->for_each_error([&](const char* production, const char* tag,
+                                      std::uint64_t count) {
+                auto iter = std::find_if(result.errors.begin(), result.errors.end(), [&](auto& e) {
+                    return e.production == production && e.tag == tag;
+                });
+                if (iter == result.errors.end())
+                    result.errors.push_back({production, tag, count});
+                else
+                    iter->count += count;
+            });
+        }
+
+        std::sort(result.productions.begin(), result.productions.end(),
+                  [](auto& lhs, auto& rhs) { return lhs.production < rhs.production; });
+        std::sort(result.errors.begin(), result.errors.end(), [](auto& lhs, auto& rhs) {
+            return lhs.production != rhs.production ? lhs.production < rhs.production
+                                                    : lhs.tag < rhs.tag;
+        });
+        return result;
+    }
+
+private:
+    _metrics_shard& _local_shard()
+    {
+        struct cache
+        {
+            std::uint64_t   id;
+            _metrics_shard* shard;
+        };
+        thread_local cache local = {std::uint64_t(-1), nullptr};
+        if (local.id == _id)
+            return *local.shard;
+
+        // Look for a shard of a previous thread with the same id, it is no longer written to.
+        auto owner = std::this_thread::get_id();
+        auto head  = _shards.load(std::memory_order_acquire);
+        for (auto shard = head; shard; shard = shard->_next)
+            if (shard->_owner == owner)
+            {
+                local = {_id, shard};
+                return *shard;
+            }
+
+        auto shard   = new _metrics_shard(owner);
+        shard->_next = head;
+        while (!_shards.compare_exchange_weak(shard->_next, shard, std::memory_order_release,
+                                              std::memory_order_acquire))
+        {}
+
+        local = {_id, shard};
+        return *shard;
+    }
+
+    static std::atomic<std::uint64_t>& _next_id()
+    {
+        static std::atomic<std::uint64_t> id(0);
+        return id;
+    }
+
+    std::uint64_t                 _id;
+    std::atomic<_metrics_shard*> _shards;
+
+    friend class _metrics_recorder;
+};
+
+// Escapes a Prometheus label value.
+inline void _append_label(std::string& out, const char* name, const std::string& value)
+{
+    out += name;
+    out += "=\"";
+    for (auto c : value)
+    {
+        if (c == '\\' || c == '"')
+        {
+            out += '\\';
+            out += c;
+        }
+        else if (c == '\n')
+            out += "\\n";
+        else
+            out += c;
+    }
+    out += '"';
+}
+
+template <typename... Args>
+void _append_format(std::string& out, const char* fmt, Args... args)
+{
+    char buffer[64];
+    auto size = std::snprintf(buffer, sizeof(buffer), fmt, args...);
+    out.append(buffer, std::size_t(size));
+}
+
+template <std::size_t N>
+void _append_histogram(std::string& out, const char* metric, const std::string& production,
+                       const double (&bounds)[N], const std::uint64_t (&buckets)[N + 1], double sum)
+{
+    auto count = std::uint64_t(0);
+    for (auto i = std::size_t(0); i != N + 1; ++i)
+    {
+        count += buckets[i];
+
+        out += metric;
+        out += "_bucket{";
+        _append_label(out, "production", production);
+        if (i == N)
+            out += ",le=\"+Inf\"} ";
+        else
+            _append_format(out, ",le=\"%g\"} ", bounds[i]);
+        _append_format(out, "%llu\n", static_cast<unsigned long long>(count));
+    }
+
+    out += metric;
+    out += "_sum{";
+    _append_label(out, "production", production);
+    _append_format(out, "} %.9g\n", sum);
+
+    out += metric;
+    out += "_count{";
+    _append_label(out, "production", production);
+    _append_format(out, "} %llu\n", static_cast<unsigned long long>(count));
+}
+
+/// Renders the snapshot in the Prometheus text exposition format.
+inline std::string to_prometheus(const parse_metrics_snapshot& snapshot)
+{
+    std::string out;
+
+    auto counter = [&](const char* metric, const char* help, auto member) {
+        out += "# HELP ";
+        out += metric;
+        out += ' ';
+        out += help;
+        out += "\n# TYPE ";
+        out += metric;
+        out += " counter\n";
+        for (auto& p : snapshot.productions)
+        {
+            out += metric;
+            out += '{';
+            _append_label(out, "production", p.production);
+            _append_format(out, "} %llu\n", static_cast<unsigned long long>(p.*member));
+        }
+    };
+    counter("lexy_parses_total", "Number of parses.",
+            &parse_metrics_snapshot::production_metrics::parses);
+    counter("lexy_parse_bytes_total", "Number of bytes consumed by parses.",
+            &parse_metrics_snapshot::production_metrics::bytes);
+
+    out += "# HELP lexy_parse_results_total Number of parses by result.\n";
+    out += "# TYPE lexy_parse_results_total counter\n";
+    for (auto& p : snapshot.productions)
+    {
+        auto result = [&](const char* name, std::uint64_t value) {
+            out += "lexy_parse_results_total{";
+            _append_label(out, "production", p.production);
+            _append_format(out, ",result=\"%s\"} %llu\n", name,
+                           static_cast<unsigned long long>(value));
+        };
+        result("success", p.successes);
+        result("recovered_error", p.recovered_errors);
+        result("fatal_error", p.fatal_errors);
+    }
+
+    out += "# HELP lexy_parse_errors_total Number of errors raised by tag.\n";
+    out += "# TYPE lexy_parse_errors_total counter\n";
+    for (auto& e : snapshot.errors)
+    {
+        out += "lexy_parse_errors_total{";
+        _append_label(out, "production", e.production);
+        out += ',';
+        _append_label(out, "tag", e.tag);
+        _append_format(out, "} %llu\n", static_cast<unsigned long long>(e.count));
+    }
+
+    out += "# HELP lexy_parse_duration_seconds Latency of parses.\n";
+    out += "# TYPE lexy_parse_duration_seconds histogram\n";
+    for (auto& p : snapshot.productions)
+        _append_histogram(out, "lexy_parse_duration_seconds", p.production,
+                          parse_latency_buckets, p.latency_buckets, p.latency_sum);
+
+    out += "# HELP lexy_parse_throughput_bytes_per_second Throughput of parses.\n";
+    out += "# TYPE lexy_parse_throughput_bytes_per_second histogram\n";
+    for (auto& p : snapshot.productions)
+        _append_histogram(out, "lexy_parse_throughput_bytes_per_second", p.production,
+                          parse_throughput_buckets, p.throughput_buckets, p.throughput_sum);
+
+    return out;
+}
+
+/// Writes the snapshot in the Prometheus text exposition format to the file.
+inline void write_prometheus(std::FILE* file, const parse_metrics_snapshot& snapshot)
+{
+    auto str = to_prometheus(snapshot);
+    std::fwrite(str.data(), 1, str.size(), file);
+}
+} // namespace lexy_ext
+
+namespace lexy_ext
+{
+template <typename Reader, typename Tag>
+constexpr const char* _metrics_tag_name(const lexy::error<Reader, Tag>&)
+{
+    return lexy::_detail::type_name<Tag>();
+}
+
+// Records the metrics of a single parse.
+class _metrics_recorder
+{
+public:
+    explicit _metrics_recorder(parse_metrics& metrics, const char* production)
+    : _shard(&metrics._local_shard()), _entry(&_shard->production(production)),
+      _production(production), _start(std::chrono::steady_clock::now())
+    {}
+
+    void error(const char* tag)
+    {
+        _shard->error(_production, tag);
+    }
+
+    template <typename Iterator, typename Result>
+    void finish(Iterator begin, Iterator end, const Result& result)
+    {
+        auto latency = std::chrono::steady_clock::now() - _start;
+        auto ns      = std::uint64_t(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count());
+        auto bytes = std::uint64_t(lexy::_detail::range_size(begin, end)
+                                   * sizeof(typename std::iterator_traits<Iterator>::value_type));
+
+        _add(_entry->parses, std::uint64_t(1));
+        _add(_entry->bytes, bytes);
+        if (result.is_success())
+            _add(_entry->successes, std::uint64_t(1));
+        else if (result.is_recovered_error())
+            _add(_entry->recovered_errors, std::uint64_t(1));
+        else
+            _add(_entry->fatal_errors, std::uint64_t(1));
+
+        auto seconds = double(ns) / 1e9;
+        _add(_entry->latency_ns, ns);
+        _add(_entry->latency_buckets[_bucket_of(parse_latency_buckets, seconds)],
+             std::uint64_t(1));
+
+        if (ns > 0)
+        {
+            auto throughput = double(bytes) / seconds;
+            _add(_entry->throughput, throughput);
+            _add(_entry->throughput_buckets[_bucket_of(parse_throughput_buckets, throughput)],
+                 std::uint64_t(1));
+        }
+    }
+
+private:
+    _metrics_shard*                       _shard;
+    _production_metrics*                  _entry;
+    const char*                           _production;
+    std::chrono::steady_clock::time_point _start;
+};
+
+// Forwards to another handler while counting the errors.
+template <typename Handler>
+class _metrics_handler
+{
+public:
+    constexpr explicit _metrics_handler(Handler& handler, _metrics_recorder& recorder)
+    : _handler(&handler), _recorder(&recorder)
+    {}
+
+    constexpr auto& get_state()
+    {
+        return _handler->get_state();
+    }
+
+    //=== handler functions ===//
+    template <typename Production>
+    using return_type_for = typename Handler::template return_type_for<Production>;
+
+    template <typename Production>
+    constexpr auto get_sink(Production p)
+    {
+        return _handler->get_sink(p);
+    }
+
+    template <typename Production, typename Iterator>
+    constexpr auto start_production(Production p, Iterator pos)
+    {
+        return _handler->start_production(p, pos);
+    }
+
+    template <typename Kind, typename Iterator>
+    constexpr void token(Kind kind, Iterator begin, Iterator end)
+    {
+        _handler->token(kind, begin, end);
+    }
+
+    template <typename Production, typename State, typename... Args>
+    constexpr auto finish_production(Production p, State&& state, Args&&... args)
+    {
+        return _handler->finish_production(p, LEXY_FWD(state), LEXY_FWD(args)...);
+    }
+    template <typename Production, typename State>
+    constexpr void backtrack_production(Production p, State&& state)
+    {
+        _handler->backtrack_production(p, LEXY_FWD(state));
+    }
+
+    template <typename Production, typename State, typename Error>
+    constexpr void error(Production p, State&& state, Error&& error)
+    {
+        _recorder->error(_metrics_tag_name(error));
+        _handler->error(p, LEXY_FWD(state), LEXY_FWD(error));
+    }
+
+private:
+    Handler*           _handler;
+    _metrics_recorder* _recorder;
+};
+} // namespace lexy_ext
+
+namespace lexy
+{
+template <typename Handler>
+constexpr bool _is_parse_handler<lexy_ext::_metrics_handler<Handler>> = _is_parse_handler<Handler>;
+} // namespace lexy
+
+namespace lexy_ext
+{
+/// Parses the production like `lexy::parse()`, recording the metrics of the parse.
+template <typename Production, typename Input, typename State, typename Callback>
+auto parse_with_metrics(const Input& input, State&& state, parse_metrics& metrics,
+                        Callback callback)
+{
+    _metrics_recorder recorder(metrics, lexy::production_name<Production>());
+
+    auto handler         = lexy::_parse_handler(state, input, LEXY_MOV(callback));
+    auto metrics_handler = _metrics_handler(handler, recorder);
+    auto reader          = input.reader();
+    auto begin           = reader.cur();
+
+    auto value  = lexy::_detail::parse_impl<Production>(metrics_handler, reader);
+    auto result = LEXY_MOV(handler).get_result(LEXY_MOV(value));
+    recorder.finish(begin, reader.cur(), result);
+    return result;
+}
+template <typename Production, typename Input, typename Callback>
+auto parse_with_metrics(const Input& input, parse_metrics& metrics, Callback callback)
+{
+    return parse_with_metrics<Production>(input, lexy::_no_parse_state{}, metrics,
+                                          LEXY_MOV(callback));
+}
+
+/// Validates the production like `lexy::validate()`, recording the metrics of the parse.
+template <typename Production, typename Input, typename ErrorCallback>
+auto validate_with_metrics(const Input& input, parse_metrics& metrics,
+                           const ErrorCallback& callback) -> lexy::validate_result<ErrorCallback>
+{
+    _metrics_recorder recorder(metrics, lexy::production_name<Production>());
+
+    auto handler         = lexy::validate_handler(input, callback);
+    auto metrics_handler = _metrics_handler(handler, recorder);
+    auto reader          = input.reader();
+    auto begin           = reader.cur();
+
+    auto did_recover = lexy::_detail::parse_impl<Production>(metrics_handler, reader);
+    auto result      = LEXY_MOV(handler).get_result(static_cast<bool>(did_recover));
+    recorder.finish(begin, reader.cur(), result);
+    return result;
+}
+} // namespace lexy_ext
+
+#endif // LEXY_EXT_PARSE_METRICS_HPP_INCLUDED
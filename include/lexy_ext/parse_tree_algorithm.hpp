@@ -5,20 +5,22 @@
 #ifndef LEXY_EXT_PARSE_TREE_ALGORITHM_HPP_INCLUDED
 #define LEXY_EXT_PARSE_TREE_ALGORITHM_HPP_INCLUDED
 
+#include <cstdint>
 #include <lexy/parse_tree.hpp>
 #include <optional>
+#include <unordered_map>
 
 namespace lexy_ext
 {
 /// Returns a range that contains only the token nodes that are descendants of the node.
 /// If the node is itself a token, returns a range that contains only the node itself.
-template <typename Reader, typename TokenKind, typename MemoryResource>
-auto tokens(const lexy::parse_tree<Reader, TokenKind, MemoryResource>&,
-            typename lexy::parse_tree<Reader, TokenKind, MemoryResource>::node node)
+template <typename Reader, typename TokenKind, typename MemoryResource, typename Layout>
+auto tokens(const lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>&,
+            typename lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>::node node)
 {
-    using node_t = typename lexy::parse_tree<Reader, TokenKind, MemoryResource>::node;
-    using traverse_iterator =
-        typename lexy::parse_tree<Reader, TokenKind, MemoryResource>::traverse_range::iterator;
+    using node_t = typename lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>::node;
+    using traverse_iterator = typename lexy::parse_tree<Reader, TokenKind, MemoryResource,
+                                                        Layout>::traverse_range::iterator;
 
     class token_range
     {
@@ -112,8 +114,8 @@ auto tokens(const lexy::parse_tree<Reader, TokenKind, MemoryResource>&,
     return token_range(node);
 }
 
-template <typename Reader, typename TokenKind, typename MemoryResource>
-auto tokens(const lexy::parse_tree<Reader, TokenKind, MemoryResource>& tree)
+template <typename Reader, typename TokenKind, typename MemoryResource, typename Layout>
+auto tokens(const lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>& tree)
 {
     LEXY_PRECONDITION(!tree.empty());
     return tokens(tree, tree.root());
@@ -124,10 +126,10 @@ namespace lexy_ext
 {
 /// Returns the node of the tree that covers the position.
 /// It is always a token.
-template <typename Reader, typename TokenKind, typename MemoryResource>
-auto find_covering_node(const lexy::parse_tree<Reader, TokenKind, MemoryResource>& tree,
-                        typename Reader::iterator                                  position) ->
-    typename lexy::parse_tree<Reader, TokenKind, MemoryResource>::node
+template <typename Reader, typename TokenKind, typename MemoryResource, typename Layout>
+auto find_covering_node(const lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>& tree,
+                        typename Reader::iterator                                          position) ->
+    typename lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>::node
 {
     LEXY_PRECONDITION(!tree.empty());
 
@@ -237,10 +239,11 @@ _filtered_node_range(Predicate&& pred, Iterator begin, Sentinel end) noexcept
 /// If predicate is a token kind, keeps only children of the same token kind.
 /// If predicate is a production, keeps only children of that production.
 /// Otherwise, predicate is a function object that is invoked with the node.
-template <typename Reader, typename TokenKind, typename MemoryResource, typename Predicate>
-auto children(const lexy::parse_tree<Reader, TokenKind, MemoryResource>&,
-              typename lexy::parse_tree<Reader, TokenKind, MemoryResource>::node node,
-              Predicate                                                          predicate)
+template <typename Reader, typename TokenKind, typename MemoryResource, typename Layout,
+          typename Predicate>
+auto children(const lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>&,
+              typename lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>::node node,
+              Predicate                                                                  predicate)
 {
     if constexpr (std::is_constructible_v<lexy::token_kind<TokenKind>, Predicate>)
         return _filtered_node_range([kind = predicate](auto n) { return n.kind() == kind; },
@@ -254,11 +257,12 @@ auto children(const lexy::parse_tree<Reader, TokenKind, MemoryResource>&,
 }
 
 /// Returns the first child that matches predicate, if there is any.
-template <typename Reader, typename TokenKind, typename MemoryResource, typename Predicate>
-auto child(const lexy::parse_tree<Reader, TokenKind, MemoryResource>&         tree,
-           typename lexy::parse_tree<Reader, TokenKind, MemoryResource>::node node,
-           Predicate                                                          predicate)
-    -> std::optional<typename lexy::parse_tree<Reader, TokenKind, MemoryResource>::node>
+template <typename Reader, typename TokenKind, typename MemoryResource, typename Layout,
+          typename Predicate>
+auto child(const lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>&         tree,
+           typename lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>::node node,
+           Predicate                                                                  predicate)
+    -> std::optional<typename lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>::node>
 {
     auto range = children(tree, node, predicate);
     if (range.empty())
@@ -276,10 +280,10 @@ namespace lexy_ext
 /// For a production node, this is the position designated by a `dsl::position` rule, or otherwise
 /// the position of its first non-empty child. If a production node is empty, it returns a default
 /// constructed iterator.
-template <typename Reader, typename TokenKind, typename MemoryResource>
-auto node_position(const lexy::parse_tree<Reader, TokenKind, MemoryResource>&         tree,
-                   typename lexy::parse_tree<Reader, TokenKind, MemoryResource>::node node) ->
-    typename Reader::iterator
+template <typename Reader, typename TokenKind, typename MemoryResource, typename Layout>
+auto node_position(const lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>& tree,
+                   typename lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>::node node)
+    -> typename Reader::iterator
 {
     if (auto pos_node = child(tree, node, lexy::position_token_kind))
         return pos_node->lexeme().begin();
@@ -291,5 +295,129 @@ auto node_position(const lexy::parse_tree<Reader, TokenKind, MemoryResource>&
 }
 } // namespace lexy_ext
 
+namespace lexy_ext
+{
+template <typename Node, typename Callback>
+void _diff_subtrees(Node old_node, Node new_node, Callback& callback)
+{
+    if (old_node.subtree_hash() == new_node.subtree_hash())
+        // The subtrees are equal, so there is nothing to report.
+        return;
+
+    auto old_kind = old_node.kind();
+    auto new_kind = new_node.kind();
+    if (old_kind.is_production() && new_kind.is_production() && old_kind == new_kind
+        && old_node.children().size() == new_node.children().size())
+    {
+        // The difference is in the children, so narrow it down.
+        auto new_child = new_node.children().begin();
+        for (auto old_child : old_node.children())
+        {
+            _diff_subtrees(old_child, *new_child, callback);
+            ++new_child;
+        }
+    }
+    else
+        callback(old_node, new_node);
+}
+
+/// Invokes the callback with the nodes of the old and new tree whose subtrees differ.
+///
+/// It requires trees with a `lexy::parse_tree_hashed_layout`: subtrees with the same hash are
+/// considered equal and skipped. A pair of production nodes of the same kind and with the same
+/// number of children is narrowed down to the pairs of children, any other pair is reported.
+template <typename Reader, typename TokenKind, typename MemoryResource, typename Layout,
+          typename Callback>
+void diff_subtrees(const lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>& old_tree,
+                   const lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>& new_tree,
+                   Callback                                                           callback)
+{
+    LEXY_PRECONDITION(!old_tree.empty() && !new_tree.empty());
+    _diff_subtrees(old_tree.root(), new_tree.root(), callback);
+}
+} // namespace lexy_ext
+
+namespace lexy_ext
+{
+/// Maps each distinct subtree to the first production node with that subtree that was inserted.
+///
+/// It requires trees with a `lexy::parse_tree_hashed_layout`: subtrees with the same hash are
+/// considered equal. The trees have to outlive the index.
+template <typename Tree>
+class subtree_index
+{
+public:
+    using node = typename Tree::node;
+
+    subtree_index() = default;
+
+    bool empty() const noexcept
+    {
+        return _nodes.empty();
+    }
+    std::size_t size() const noexcept
+    {
+        return _nodes.size();
+    }
+
+    /// Inserts all production nodes of the tree and returns the canonical node of its root.
+    node insert(const Tree& tree)
+    {
+        LEXY_PRECONDITION(!tree.empty());
+        return insert(tree, tree.root());
+    }
+
+    /// Inserts all production nodes of the subtree and returns the canonical node of its root.
+    node insert(const Tree& tree, node n)
+    {
+        using iterator = typename Tree::traverse_range::iterator;
+
+        auto range = tree.traverse(n);
+        for (auto iter = range.begin(); iter != range.end(); ++iter)
+        {
+            if (iter->event != lexy::traverse_event::enter)
+                continue;
+
+            auto cur = iter->node;
+            if (!_nodes.try_emplace(cur.subtree_hash(), cur).second)
+                // We already know the subtree, and thus all of its children.
+                iter = iterator(lexy::traverse_event::exit, cur);
+        }
+
+        return canonical(n);
+    }
+
+    /// Returns the production node with the hash, if there is any.
+    std::optional<node> find(std::uint_least64_t hash) const
+    {
+        auto iter = _nodes.find(hash);
+        if (iter == _nodes.end())
+            return std::nullopt;
+        else
+            return iter->second;
+    }
+
+    /// Returns the inserted node whose subtree is equal to the subtree of `n`.
+    /// If there is none, or `n` is a token, returns `n` itself.
+    node canonical(node n) const
+    {
+        if (n.kind().is_token())
+            return n;
+        else if (auto result = find(n.subtree_hash()))
+            return *result;
+        else
+            return n;
+    }
+
+    void clear() noexcept
+    {
+        _nodes.clear();
+    }
+
+private:
+    std::unordered_map<std::uint_least64_t, node> _nodes;
+};
+} // namespace lexy_ext
+
 #endif // LEXY_EXT_PARSE_TREE_ALGORITHM_HPP_INCLUDED
 
@@ -107,20 +107,20 @@ public:
         return expected._tree + doctest::String("         ");
     }
 
-    template <typename Reader, typename MemoryResource>
-    friend bool operator==(const parse_tree_desc&                                     desc,
-                           const lexy::parse_tree<Reader, TokenKind, MemoryResource>& tree)
+    template <typename Reader, typename MemoryResource, typename Layout>
+    friend bool operator==(const parse_tree_desc&                                             desc,
+                           const lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>& tree)
     {
         using string_maker
-            = doctest::StringMaker<lexy::parse_tree<Reader, TokenKind, MemoryResource>>;
+            = doctest::StringMaker<lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>>;
         return toString(desc) == string_maker::convert(tree);
     }
-    template <typename Reader, typename MemoryResource>
-    friend bool operator==(const lexy::parse_tree<Reader, TokenKind, MemoryResource>& tree,
-                           const parse_tree_desc&                                     desc)
+    template <typename Reader, typename MemoryResource, typename Layout>
+    friend bool operator==(const lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>& tree,
+                           const parse_tree_desc&                                             desc)
     {
         using string_maker
-            = doctest::StringMaker<lexy::parse_tree<Reader, TokenKind, MemoryResource>>;
+            = doctest::StringMaker<lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>>;
         return toString(desc) == string_maker::convert(tree);
     }
 
@@ -146,10 +146,10 @@ private:
 
 namespace doctest
 {
-template <typename Reader, typename TokenKind, typename MemoryResource>
-struct StringMaker<lexy::parse_tree<Reader, TokenKind, MemoryResource>>
+template <typename Reader, typename TokenKind, typename MemoryResource, typename Layout>
+struct StringMaker<lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>>
 {
-    using parse_tree = lexy::parse_tree<Reader, TokenKind, MemoryResource>;
+    using parse_tree = lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>;
 
     static String convert(const parse_tree& tree)
     {
@@ -23,9 +23,9 @@ struct dump_parse_tree_label
 constexpr dump_parse_tree_label simple_parse_tree_dump = {"  ", "  ", "- ", "- "};
 constexpr dump_parse_tree_label fancy_parse_tree_dump  = {"   ", "│  ", "└──", "├──"};
 
-template <typename Reader, typename TokenKind, typename MemoryResource>
-void dump_parse_tree(std::FILE*                                                 out,
-                     const lexy::parse_tree<Reader, TokenKind, MemoryResource>& tree,
+template <typename Reader, typename TokenKind, typename MemoryResource, typename Layout>
+void dump_parse_tree(std::FILE*                                                         out,
+                     const lexy::parse_tree<Reader, TokenKind, MemoryResource, Layout>& tree,
                      dump_parse_tree_label label = fancy_parse_tree_dump)
 {
     std::vector<bool> prefix_info;
@@ -0,0 +1,143 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_EXT_STATIC_VECTOR_HPP_INCLUDED
+#define LEXY_EXT_STATIC_VECTOR_HPP_INCLUDED
+
+#include <cstddef>
+#include <lexy/_detail/assert.hpp>
+#include <lexy/_detail/config.hpp>
+
+namespace lexy_ext
+{
+/// A vector with a fixed capacity that doesn't allocate memory.
+///
+/// It can be used with `lexy::as_list` and `lexy::as_string` to parse during constant evaluation,
+/// e.g. to parse configuration that is embedded into the program at compile-time.
+/// The elements must be default constructible.
+template <typename T, std::size_t Capacity>
+class static_vector
+{
+    static_assert(Capacity > 0);
+
+public:
+    using value_type     = T;
+    using iterator       = T*;
+    using const_iterator = const T*;
+
+    constexpr static_vector() noexcept : _data{}, _size(0) {}
+    constexpr static_vector(const T* data, std::size_t size) : static_vector()
+    {
+        append(data, size);
+    }
+
+    //=== access ===//
+    constexpr bool empty() const noexcept
+    {
+        return _size == 0;
+    }
+    constexpr std::size_t size() const noexcept
+    {
+        return _size;
+    }
+    static constexpr std::size_t capacity() noexcept
+    {
+        return Capacity;
+    }
+
+    constexpr T* data() noexcept
+    {
+        return _data;
+    }
+    constexpr const T* data() const noexcept
+    {
+        return _data;
+    }
+
+    constexpr iterator begin() noexcept
+    {
+        return _data;
+    }
+    constexpr iterator end() noexcept
+    {
+        return _data + _size;
+    }
+    constexpr const_iterator begin() const noexcept
+    {
+        return _data;
+    }
+    constexpr const_iterator end() const noexcept
+    {
+        return _data + _size;
+    }
+
+    constexpr T& operator[](std::size_t idx) noexcept
+    {
+        LEXY_PRECONDITION(idx < _size);
+        return _data[idx];
+    }
+    constexpr const T& operator[](std::size_t idx) const noexcept
+    {
+        LEXY_PRECONDITION(idx < _size);
+        return _data[idx];
+    }
+
+    //=== modifiers ===//
+    constexpr void push_back(const T& value)
+    {
+        LEXY_PRECONDITION(_size < Capacity);
+        _data[_size++] = value;
+    }
+    constexpr void push_back(T&& value)
+    {
+        LEXY_PRECONDITION(_size < Capacity);
+        _data[_size++] = LEXY_MOV(value);
+    }
+
+    template <typename... Args>
+    constexpr T& emplace_back(Args&&... args)
+    {
+        LEXY_PRECONDITION(_size < Capacity);
+        _data[_size] = T(LEXY_FWD(args)...);
+        return _data[_size++];
+    }
+
+    constexpr void append(const T* data, std::size_t size)
+    {
+        LEXY_PRECONDITION(_size + size <= Capacity);
+        for (auto i = std::size_t(0); i != size; ++i)
+            _data[_size++] = data[i];
+    }
+    constexpr void append(const static_vector& other)
+    {
+        append(other.data(), other.size());
+    }
+
+    constexpr void clear() noexcept
+    {
+        _size = 0;
+    }
+
+    //=== comparison ===//
+    friend constexpr bool operator==(const static_vector& lhs, const static_vector& rhs)
+    {
+        if (lhs._size != rhs._size)
+            return false;
+        for (auto i = std::size_t(0); i != lhs._size; ++i)
+            if (!(lhs._data[i] == rhs._data[i]))
+                return false;
+        return true;
+    }
+    friend constexpr bool operator!=(const static_vector& lhs, const static_vector& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    T           _data[Capacity];
+    std::size_t _size;
+};
+} // namespace lexy_ext
+
+#endif // LEXY_EXT_STATIC_VECTOR_HPP_INCLUDED
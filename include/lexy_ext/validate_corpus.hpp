@@ -0,0 +1,160 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_EXT_VALIDATE_CORPUS_HPP_INCLUDED
+#define LEXY_EXT_VALIDATE_CORPUS_HPP_INCLUDED
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <lexy/_detail/lazy_init.hpp>
+#include <lexy/input/file.hpp>
+#include <lexy/validate.hpp>
+
+namespace lexy_ext
+{
+struct validate_corpus_options
+{
+    /// The number of worker threads; zero uses `std::thread::hardware_concurrency()`.
+    unsigned thread_count = 0;
+};
+
+/// The input that is passed to the error callback of `validate_corpus()`.
+template <typename Encoding = lexy::default_encoding>
+using corpus_input = lexy::read_file_result<Encoding>;
+
+/// The result of validating a single file of the corpus.
+template <typename ErrorCallback>
+class corpus_result
+{
+public:
+    using validate_result = lexy::validate_result<ErrorCallback>;
+
+    corpus_result() noexcept : _file_error(lexy::file_error::os_error) {}
+
+    /// Whether the file could be read and validated without errors.
+    explicit operator bool() const noexcept
+    {
+        return !has_file_error() && _result->is_success();
+    }
+
+    bool has_file_error() const noexcept
+    {
+        return _file_error != lexy::file_error::_success;
+    }
+    lexy::file_error file_error() const noexcept
+    {
+        LEXY_PRECONDITION(has_file_error());
+        return _file_error;
+    }
+
+    const validate_result& result() const& noexcept
+    {
+        LEXY_PRECONDITION(!has_file_error());
+        return *_result;
+    }
+    validate_result&& result() && noexcept
+    {
+        LEXY_PRECONDITION(!has_file_error());
+        return LEXY_MOV(*_result);
+    }
+
+private:
+    lexy::file_error                          _file_error;
+    lexy::_detail::lazy_init<validate_result> _result;
+
+    template <typename Production, typename Encoding, typename Paths, typename Callback>
+    friend auto validate_corpus(const Paths&, const Callback&, validate_corpus_options)
+        -> std::vector<corpus_result<Callback>>;
+};
+
+inline const char* _corpus_path(const char* path) noexcept
+{
+    return path;
+}
+inline const char* _corpus_path(const std::string& path) noexcept
+{
+    return path.c_str();
+}
+
+/// Reads and validates every file in `paths` on a pool of worker threads.
+///
+/// Workers pick the next file from a shared cursor over the files sorted by size, largest first,
+/// so big files are started early and small ones fill the gaps; reading of one file overlaps with
+/// validation of others. Results are returned in the order of `paths`.
+///
+/// The error callback is invoked concurrently and must not keep references into the input, as it is
+/// freed after validation; `lexy::collect_compact` stores offsets instead.
+template <typename Production, typename Encoding = lexy::default_encoding, typename Paths,
+          typename ErrorCallback>
+auto validate_corpus(const Paths& paths, const ErrorCallback& callback,
+                     validate_corpus_options options = {})
+    -> std::vector<corpus_result<ErrorCallback>>
+{
+    std::vector<const char*> files;
+    for (const auto& path : paths)
+        files.push_back(_corpus_path(path));
+
+    std::vector<corpus_result<ErrorCallback>> results(files.size());
+    if (files.empty())
+        return results;
+
+    // Schedule the biggest files first.
+    std::vector<std::size_t> order(files.size());
+    {
+        std::vector<std::uintmax_t> sizes(files.size());
+        for (auto i = std::size_t(0); i != files.size(); ++i)
+        {
+            order[i] = i;
+
+            std::error_code ec;
+            auto            size = std::filesystem::file_size(files[i], ec);
+            sizes[i]             = ec ? 0 : size;
+        }
+        std::stable_sort(order.begin(), order.end(),
+                         [&](std::size_t lhs, std::size_t rhs) { return sizes[lhs] > sizes[rhs]; });
+    }
+
+    std::atomic<std::size_t> cursor(0);
+    auto                     worker = [&] {
+        for (auto next = cursor++; next < order.size(); next = cursor++)
+        {
+            auto  idx    = order[next];
+            auto& result = results[idx];
+
+            auto file = lexy::read_file<Encoding>(files[idx]);
+            if (!file)
+            {
+                result._file_error = file.error();
+                continue;
+            }
+
+            result._file_error = lexy::file_error::_success;
+            result._result.emplace(lexy::validate<Production>(file, callback));
+        }
+    };
+
+    auto thread_count = options.thread_count;
+    if (thread_count == 0)
+        thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+    if (thread_count > files.size())
+        thread_count = static_cast<unsigned>(files.size());
+
+    std::vector<std::thread> threads;
+    for (auto i = 1u; i < thread_count; ++i)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads)
+        thread.join();
+
+    return results;
+}
+} // namespace lexy_ext
+
+#endif // LEXY_EXT_VALIDATE_CORPUS_HPP_INCLUDED
@@ -0,0 +1,73 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/huge_page_resource.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#    include <sys/mman.h>
+
+void* lexy::_detail::map_huge_pages(std::size_t size, bool& is_huge) noexcept
+{
+    LEXY_PRECONDITION(size % huge_page_size == 0);
+    void* memory = nullptr;
+
+#    ifdef MAP_HUGETLB
+    // Explicit huge pages only work if the administrator has reserved some.
+    memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (memory != MAP_FAILED)
+    {
+        is_huge = true;
+        return memory;
+    }
+#    endif
+
+    // Otherwise, we map more than necessary, so we can align the region to a huge page;
+    // transparent huge pages are only used for aligned memory.
+    auto mapping_size = size + huge_page_size;
+    auto mapping      = ::mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED)
+        return nullptr;
+
+    auto begin   = static_cast<unsigned char*>(mapping);
+    auto address = reinterpret_cast<std::uintptr_t>(begin);
+    auto offset  = (huge_page_size - address % huge_page_size) % huge_page_size;
+    if (offset > 0)
+        ::munmap(begin, offset);
+    ::munmap(begin + offset + size, huge_page_size - offset);
+    memory = begin + offset;
+
+#    ifdef MADV_HUGEPAGE
+    is_huge = ::madvise(memory, size, MADV_HUGEPAGE) == 0;
+#    else
+    is_huge = false;
+#    endif
+    return memory;
+}
+
+void lexy::_detail::unmap_huge_pages(void* memory, std::size_t size) noexcept
+{
+    ::munmap(memory, size);
+}
+
+#else
+
+void* lexy::_detail::map_huge_pages(std::size_t size, bool& is_huge) noexcept
+{
+    LEXY_PRECONDITION(size % huge_page_size == 0);
+
+    // We can't ask for huge pages, but aligned memory doesn't hurt.
+    is_huge = false;
+    return ::operator new(size, std::align_val_t{huge_page_size}, std::nothrow);
+}
+
+void lexy::_detail::unmap_huge_pages(void* memory, std::size_t) noexcept
+{
+    ::operator delete(memory, std::align_val_t{huge_page_size}, std::nothrow);
+}
+
+#endif
+
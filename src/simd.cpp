@@ -0,0 +1,548 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/simd.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#    define LEXY_SIMD_X86 1
+#    include <immintrin.h>
+#    ifdef _MSC_VER
+#        include <intrin.h>
+#    else
+#        include <cpuid.h>
+#    endif
+#else
+#    define LEXY_SIMD_X86 0
+#endif
+
+// GCC and clang need to be told which extensions a function can use;
+// MSVC allows all intrinsics everywhere.
+#if LEXY_SIMD_X86 && !defined(_MSC_VER)
+#    define LEXY_SIMD_TARGET(Extensions) __attribute__((target(Extensions)))
+#else
+#    define LEXY_SIMD_TARGET(Extensions)
+#endif
+
+namespace
+{
+using lexy::simd_level;
+
+int count_trailing_zeros(std::uint64_t mask) noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long result;
+    _BitScanForward64(&result, mask);
+    return int(result);
+#else
+    return __builtin_ctzll(mask);
+#endif
+}
+
+std::size_t popcount(std::uint64_t mask) noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    std::size_t result = 0;
+    for (; mask != 0; mask &= mask - 1)
+        ++result;
+    return result;
+#else
+    return std::size_t(__builtin_popcountll(mask));
+#endif
+}
+
+//=== scalar ===//
+const char* scalar_find_non_ascii(const char* cur, const char* end) noexcept
+{
+    // Eight bytes at a time.
+    for (; end - cur >= 8; cur += 8)
+    {
+        std::uint64_t word;
+        std::memcpy(&word, cur, sizeof(word));
+        if ((word & 0x8080'8080'8080'8080) != 0)
+            break;
+    }
+
+    while (cur != end && static_cast<unsigned char>(*cur) <= 0x7F)
+        ++cur;
+    return cur;
+}
+
+std::size_t scalar_count_newlines(const char* cur, const char* end) noexcept
+{
+    std::size_t result = 0;
+    for (; cur != end; ++cur)
+        if (*cur == '\n')
+            ++result;
+    return result;
+}
+
+void scalar_byte_swap16(char16_t* data, std::size_t size) noexcept
+{
+    for (auto i = std::size_t(0); i != size; ++i)
+    {
+        auto c  = static_cast<std::uint_least16_t>(data[i]);
+        data[i] = char16_t(((c & 0xFF) << 8) | (c >> 8));
+    }
+}
+
+void scalar_byte_swap32(char32_t* data, std::size_t size) noexcept
+{
+    for (auto i = std::size_t(0); i != size; ++i)
+    {
+        auto c  = static_cast<std::uint_least32_t>(data[i]);
+        data[i] = char32_t(((c & 0xFF) << 24) | ((c & 0xFF00) << 8) | ((c >> 8) & 0xFF00)
+                           | (c >> 24));
+    }
+}
+
+// Returns the end of the well-formed UTF-8 sequence starting at cur, or nullptr.
+// The ranges are from table 3-7 of the Unicode standard.
+const char* match_utf8_sequence(const char* cur, const char* end) noexcept
+{
+    auto byte = [&](std::ptrdiff_t i) { return static_cast<unsigned char>(cur[i]); };
+    auto in   = [](int c, int min, int max) { return min <= c && c <= max; };
+
+    auto lead = byte(0);
+    if (lead <= 0x7F)
+        return cur + 1;
+    else if (lead < 0xC2)
+        return nullptr;
+    else if (lead < 0xE0)
+        return end - cur >= 2 && in(byte(1), 0x80, 0xBF) ? cur + 2 : nullptr;
+    else if (lead < 0xF0)
+    {
+        if (end - cur < 3)
+            return nullptr;
+
+        auto min = lead == 0xE0 ? 0xA0 : 0x80;
+        auto max = lead == 0xED ? 0x9F : 0xBF;
+        return in(byte(1), min, max) && in(byte(2), 0x80, 0xBF) ? cur + 3 : nullptr;
+    }
+    else if (lead < 0xF5)
+    {
+        if (end - cur < 4)
+            return nullptr;
+
+        auto min = lead == 0xF0 ? 0x90 : 0x80;
+        auto max = lead == 0xF4 ? 0x8F : 0xBF;
+        return in(byte(1), min, max) && in(byte(2), 0x80, 0xBF) && in(byte(3), 0x80, 0xBF)
+                   ? cur + 4
+                   : nullptr;
+    }
+    else
+        return nullptr;
+}
+
+// Skips ASCII with the vectorized search, then validates the next sequence.
+template <const char* (*FindNonAscii)(const char*, const char*) noexcept>
+const char* find_invalid_utf8(const char* cur, const char* end) noexcept
+{
+    while (true)
+    {
+        cur = FindNonAscii(cur, end);
+        if (cur == end)
+            return end;
+
+        auto next = match_utf8_sequence(cur, end);
+        if (next == nullptr)
+            return cur;
+        cur = next;
+    }
+}
+
+#if LEXY_SIMD_X86
+//=== SSE2 ===//
+LEXY_SIMD_TARGET("sse2")
+const char* sse2_find_non_ascii(const char* cur, const char* end) noexcept
+{
+    for (; end - cur >= 16; cur += 16)
+    {
+        auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cur));
+        auto mask  = unsigned(_mm_movemask_epi8(chunk));
+        if (mask != 0)
+            return cur + count_trailing_zeros(mask);
+    }
+    return scalar_find_non_ascii(cur, end);
+}
+
+LEXY_SIMD_TARGET("sse2")
+std::size_t sse2_count_newlines(const char* cur, const char* end) noexcept
+{
+    std::size_t result  = 0;
+    auto        newline = _mm_set1_epi8('\n');
+    for (; end - cur >= 16; cur += 16)
+    {
+        auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cur));
+        result += popcount(unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newline))));
+    }
+    return result + scalar_count_newlines(cur, end);
+}
+
+LEXY_SIMD_TARGET("sse2")
+void sse2_byte_swap16(char16_t* data, std::size_t size) noexcept
+{
+    auto i = std::size_t(0);
+    for (; size - i >= 8; i += 8)
+    {
+        auto ptr   = reinterpret_cast<__m128i*>(data + i);
+        auto chunk = _mm_loadu_si128(ptr);
+        chunk      = _mm_or_si128(_mm_slli_epi16(chunk, 8), _mm_srli_epi16(chunk, 8));
+        _mm_storeu_si128(ptr, chunk);
+    }
+    scalar_byte_swap16(data + i, size - i);
+}
+
+LEXY_SIMD_TARGET("sse2")
+void sse2_byte_swap32(char32_t* data, std::size_t size) noexcept
+{
+    auto i = std::size_t(0);
+    for (; size - i >= 4; i += 4)
+    {
+        auto ptr   = reinterpret_cast<__m128i*>(data + i);
+        auto chunk = _mm_loadu_si128(ptr);
+        // Swap the bytes of each half, then the halves.
+        chunk = _mm_or_si128(_mm_slli_epi16(chunk, 8), _mm_srli_epi16(chunk, 8));
+        chunk = _mm_or_si128(_mm_slli_epi32(chunk, 16), _mm_srli_epi32(chunk, 16));
+        _mm_storeu_si128(ptr, chunk);
+    }
+    scalar_byte_swap32(data + i, size - i);
+}
+
+//=== SSE4.2 ===//
+// Searching doesn't benefit from SSE4.2 over SSE2, but the byte shuffle and popcount do.
+LEXY_SIMD_TARGET("sse4.2,popcnt")
+std::size_t sse42_count_newlines(const char* cur, const char* end) noexcept
+{
+    std::size_t result  = 0;
+    auto        newline = _mm_set1_epi8('\n');
+    for (; end - cur >= 16; cur += 16)
+    {
+        auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cur));
+        auto mask  = unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newline)));
+        result += popcount(mask);
+    }
+    return result + scalar_count_newlines(cur, end);
+}
+
+LEXY_SIMD_TARGET("sse4.2")
+void sse42_byte_swap16(char16_t* data, std::size_t size) noexcept
+{
+    auto shuffle = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+
+    auto i = std::size_t(0);
+    for (; size - i >= 8; i += 8)
+    {
+        auto ptr = reinterpret_cast<__m128i*>(data + i);
+        _mm_storeu_si128(ptr, _mm_shuffle_epi8(_mm_loadu_si128(ptr), shuffle));
+    }
+    scalar_byte_swap16(data + i, size - i);
+}
+
+LEXY_SIMD_TARGET("sse4.2")
+void sse42_byte_swap32(char32_t* data, std::size_t size) noexcept
+{
+    auto shuffle = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    auto i = std::size_t(0);
+    for (; size - i >= 4; i += 4)
+    {
+        auto ptr = reinterpret_cast<__m128i*>(data + i);
+        _mm_storeu_si128(ptr, _mm_shuffle_epi8(_mm_loadu_si128(ptr), shuffle));
+    }
+    scalar_byte_swap32(data + i, size - i);
+}
+
+//=== AVX2 ===//
+LEXY_SIMD_TARGET("avx2")
+const char* avx2_find_non_ascii(const char* cur, const char* end) noexcept
+{
+    for (; end - cur >= 32; cur += 32)
+    {
+        auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cur));
+        auto mask  = unsigned(_mm256_movemask_epi8(chunk));
+        if (mask != 0)
+            return cur + count_trailing_zeros(mask);
+    }
+    return sse2_find_non_ascii(cur, end);
+}
+
+LEXY_SIMD_TARGET("avx2,popcnt")
+std::size_t avx2_count_newlines(const char* cur, const char* end) noexcept
+{
+    std::size_t result  = 0;
+    auto        newline = _mm256_set1_epi8('\n');
+    for (; end - cur >= 32; cur += 32)
+    {
+        auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cur));
+        auto mask  = unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, newline)));
+        result += popcount(mask);
+    }
+    return result + sse42_count_newlines(cur, end);
+}
+
+LEXY_SIMD_TARGET("avx2")
+void avx2_byte_swap16(char16_t* data, std::size_t size) noexcept
+{
+    // The shuffle works on each 128 bit lane separately.
+    auto shuffle = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, //
+                                    1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+
+    auto i = std::size_t(0);
+    for (; size - i >= 16; i += 16)
+    {
+        auto ptr = reinterpret_cast<__m256i*>(data + i);
+        _mm256_storeu_si256(ptr, _mm256_shuffle_epi8(_mm256_loadu_si256(ptr), shuffle));
+    }
+    sse42_byte_swap16(data + i, size - i);
+}
+
+LEXY_SIMD_TARGET("avx2")
+void avx2_byte_swap32(char32_t* data, std::size_t size) noexcept
+{
+    auto shuffle = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, //
+                                    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    auto i = std::size_t(0);
+    for (; size - i >= 8; i += 8)
+    {
+        auto ptr = reinterpret_cast<__m256i*>(data + i);
+        _mm256_storeu_si256(ptr, _mm256_shuffle_epi8(_mm256_loadu_si256(ptr), shuffle));
+    }
+    sse42_byte_swap32(data + i, size - i);
+}
+
+//=== AVX-512 ===//
+LEXY_SIMD_TARGET("avx512f,avx512bw")
+const char* avx512_find_non_ascii(const char* cur, const char* end) noexcept
+{
+    for (; end - cur >= 64; cur += 64)
+    {
+        auto chunk = _mm512_loadu_si512(cur);
+        auto mask  = std::uint64_t(_mm512_movepi8_mask(chunk));
+        if (mask != 0)
+            return cur + count_trailing_zeros(mask);
+    }
+    return avx2_find_non_ascii(cur, end);
+}
+
+LEXY_SIMD_TARGET("avx512f,avx512bw,popcnt")
+std::size_t avx512_count_newlines(const char* cur, const char* end) noexcept
+{
+    std::size_t result  = 0;
+    auto        newline = _mm512_set1_epi8('\n');
+    for (; end - cur >= 64; cur += 64)
+    {
+        auto chunk = _mm512_loadu_si512(cur);
+        auto mask  = std::uint64_t(_mm512_cmpeq_epi8_mask(chunk, newline));
+        result += popcount(mask);
+    }
+    return result + avx2_count_newlines(cur, end);
+}
+
+LEXY_SIMD_TARGET("avx512f,avx512bw")
+void avx512_byte_swap16(char16_t* data, std::size_t size) noexcept
+{
+    // Bytes 1, 0, 3, 2, ..., 15, 14 of each 128 bit lane.
+    auto shuffle = _mm512_set4_epi32(0x0E0F'0C0D, 0x0A0B'0809, 0x0607'0405, 0x0203'0001);
+
+    auto i = std::size_t(0);
+    for (; size - i >= 32; i += 32)
+    {
+        auto ptr = data + i;
+        _mm512_storeu_si512(ptr, _mm512_shuffle_epi8(_mm512_loadu_si512(ptr), shuffle));
+    }
+    avx2_byte_swap16(data + i, size - i);
+}
+
+LEXY_SIMD_TARGET("avx512f,avx512bw")
+void avx512_byte_swap32(char32_t* data, std::size_t size) noexcept
+{
+    // Bytes 3, 2, 1, 0, ..., 15, 14, 13, 12 of each 128 bit lane.
+    auto shuffle = _mm512_set4_epi32(0x0C0D'0E0F, 0x0809'0A0B, 0x0405'0607, 0x0001'0203);
+
+    auto i = std::size_t(0);
+    for (; size - i >= 16; i += 16)
+    {
+        auto ptr = data + i;
+        _mm512_storeu_si512(ptr, _mm512_shuffle_epi8(_mm512_loadu_si512(ptr), shuffle));
+    }
+    avx2_byte_swap32(data + i, size - i);
+}
+#endif
+
+//=== detection ===//
+#if LEXY_SIMD_X86
+struct cpuid_result
+{
+    std::uint32_t eax, ebx, ecx, edx;
+};
+
+cpuid_result cpuid(std::uint32_t leaf) noexcept
+{
+#    ifdef _MSC_VER
+    int registers[4];
+    __cpuidex(registers, int(leaf), 0);
+    return {std::uint32_t(registers[0]), std::uint32_t(registers[1]),
+            std::uint32_t(registers[2]), std::uint32_t(registers[3])};
+#    else
+    cpuid_result result{};
+    if (!__get_cpuid_count(leaf, 0, &result.eax, &result.ebx, &result.ecx, &result.edx))
+        return cpuid_result{};
+    return result;
+#    endif
+}
+
+// The register state the OS saves on a context switch.
+std::uint64_t xgetbv() noexcept
+{
+#    ifdef _MSC_VER
+    return _xgetbv(0);
+#    else
+    std::uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (std::uint64_t(edx) << 32) | eax;
+#    endif
+}
+
+simd_level detect_level() noexcept
+{
+    auto bit = [](std::uint32_t reg, int i) { return (reg & (std::uint32_t(1) << i)) != 0; };
+
+    auto max_leaf = cpuid(0).eax;
+    auto leaf1    = cpuid(1);
+    if (!bit(leaf1.edx, 26))
+        return simd_level::scalar;
+    if (!bit(leaf1.ecx, 9) || !bit(leaf1.ecx, 19) || !bit(leaf1.ecx, 20) || !bit(leaf1.ecx, 23))
+        // SSSE3, SSE4.1, SSE4.2 and POPCNT.
+        return simd_level::sse2;
+
+    // The OS needs to save the AVX registers as well.
+    if (max_leaf < 7 || !bit(leaf1.ecx, 27) || !bit(leaf1.ecx, 28))
+        return simd_level::sse4_2;
+    auto xcr0 = xgetbv();
+    if ((xcr0 & 0x6) != 0x6)
+        return simd_level::sse4_2;
+
+    auto leaf7 = cpuid(7);
+    if (!bit(leaf7.ebx, 5))
+        return simd_level::sse4_2;
+
+    // AVX-512 F and BW, and the opmask and upper ZMM registers.
+    if (!bit(leaf7.ebx, 16) || !bit(leaf7.ebx, 30) || (xcr0 & 0xE0) != 0xE0)
+        return simd_level::avx2;
+    return simd_level::avx512;
+}
+#else
+simd_level detect_level() noexcept
+{
+    return simd_level::scalar;
+}
+#endif
+
+//=== dispatch ===//
+struct kernel_table
+{
+    simd_level level;
+    const char* (*find_non_ascii)(const char*, const char*) noexcept;
+    const char* (*find_invalid_utf8)(const char*, const char*) noexcept;
+    std::size_t (*count_newlines)(const char*, const char*) noexcept;
+    void (*byte_swap16)(char16_t*, std::size_t) noexcept;
+    void (*byte_swap32)(char32_t*, std::size_t) noexcept;
+};
+
+constexpr kernel_table kernel_tables[] = {
+    {simd_level::scalar, scalar_find_non_ascii, find_invalid_utf8<scalar_find_non_ascii>,
+     scalar_count_newlines, scalar_byte_swap16, scalar_byte_swap32},
+#if LEXY_SIMD_X86
+    {simd_level::sse2, sse2_find_non_ascii, find_invalid_utf8<sse2_find_non_ascii>,
+     sse2_count_newlines, sse2_byte_swap16, sse2_byte_swap32},
+    {simd_level::sse4_2, sse2_find_non_ascii, find_invalid_utf8<sse2_find_non_ascii>,
+     sse42_count_newlines, sse42_byte_swap16, sse42_byte_swap32},
+    {simd_level::avx2, avx2_find_non_ascii, find_invalid_utf8<avx2_find_non_ascii>,
+     avx2_count_newlines, avx2_byte_swap16, avx2_byte_swap32},
+    {simd_level::avx512, avx512_find_non_ascii, find_invalid_utf8<avx512_find_non_ascii>,
+     avx512_count_newlines, avx512_byte_swap16, avx512_byte_swap32},
+#endif
+};
+
+simd_level supported_level() noexcept
+{
+    static const auto level = detect_level();
+    return level;
+}
+
+const kernel_table* table_for(simd_level level) noexcept
+{
+    if (level > supported_level())
+        level = supported_level();
+
+    // Not every level has a table on every architecture.
+    auto result = &kernel_tables[0];
+    for (auto& table : kernel_tables)
+        if (table.level <= level)
+            result = &table;
+    return result;
+}
+
+// Like an ifunc: the table is resolved on first use and then used directly.
+std::atomic<const kernel_table*> active_table{nullptr};
+
+const kernel_table& kernels() noexcept
+{
+    auto table = active_table.load(std::memory_order_relaxed);
+    if (table == nullptr)
+    {
+        table = table_for(supported_level());
+        active_table.store(table, std::memory_order_relaxed);
+    }
+    return *table;
+}
+} // namespace
+
+lexy::simd_level lexy::_detail::simd_supported_level() noexcept
+{
+    return supported_level();
+}
+
+lexy::simd_level lexy::_detail::simd_active_level() noexcept
+{
+    return kernels().level;
+}
+
+lexy::simd_level lexy::_detail::simd_select_level(simd_level level) noexcept
+{
+    auto table = table_for(level);
+    active_table.store(table, std::memory_order_relaxed);
+    return table->level;
+}
+
+const char* lexy::_detail::simd_find_non_ascii(const char* begin, const char* end) noexcept
+{
+    return kernels().find_non_ascii(begin, end);
+}
+
+const char* lexy::_detail::simd_find_invalid_utf8(const char* begin, const char* end) noexcept
+{
+    return kernels().find_invalid_utf8(begin, end);
+}
+
+std::size_t lexy::_detail::simd_count_newlines(const char* begin, const char* end) noexcept
+{
+    return kernels().count_newlines(begin, end);
+}
+
+void lexy::_detail::simd_byte_swap16(char16_t* data, std::size_t size) noexcept
+{
+    kernels().byte_swap16(data, size);
+}
+
+void lexy::_detail::simd_byte_swap32(char32_t* data, std::size_t size) noexcept
+{
+    kernels().byte_swap32(data, size);
+}
+
@@ -0,0 +1,172 @@
+#!/usr/bin/python3
+# Generates include/lexy/_detail/unicode_database.hpp from the Unicode database of Python.
+#
+# Every code point is mapped to a single byte: the low five bits are its general category,
+# the high bits are the binary properties below.
+# The bytes are stored in a three-stage table: the top bits of the code point select a block of
+# indices, the middle bits select a block of property bytes in it, and the low bits the byte.
+# Identical blocks are stored only once on both levels.
+
+import os
+import sys
+import unicodedata
+
+# The location of the generated file.
+output_path = os.path.join(os.path.dirname(__file__), '..', 'include', 'lexy', '_detail',
+                           'unicode_database.hpp')
+
+# The order matches `lexy::unicode_category`.
+categories = {
+    'Cn': 'unassigned',
+    'Lu': 'uppercase letter',
+    'Ll': 'lowercase letter',
+    'Lt': 'titlecase letter',
+    'Lm': 'modifier letter',
+    'Lo': 'other letter',
+    'Mn': 'nonspacing mark',
+    'Mc': 'spacing mark',
+    'Me': 'enclosing mark',
+    'Nd': 'decimal number',
+    'Nl': 'letter number',
+    'No': 'other number',
+    'Pc': 'connector punctuation',
+    'Pd': 'dash punctuation',
+    'Ps': 'open punctuation',
+    'Pe': 'close punctuation',
+    'Pi': 'initial punctuation',
+    'Pf': 'final punctuation',
+    'Po': 'other punctuation',
+    'Sm': 'math symbol',
+    'Sc': 'currency symbol',
+    'Sk': 'modifier symbol',
+    'So': 'other symbol',
+    'Zs': 'space separator',
+    'Zl': 'line separator',
+    'Zp': 'paragraph separator',
+    'Cc': 'control',
+    'Cf': 'format',
+    'Cs': 'surrogate',
+    'Co': 'private use',
+}
+category_mask = 0x1F
+
+# The binary properties.
+xid_start    = 0x20
+xid_continue = 0x40
+white_space  = 0x80
+
+# White_Space isn't exposed by Python; it is a small and stable list.
+white_space_code_points = set([*range(0x09, 0x0E), 0x20, 0x85, 0xA0, 0x1680,
+                               *range(0x2000, 0x200B), 0x2028, 0x2029, 0x202F, 0x205F, 0x3000])
+
+# The number of code points covered by one stage 2 and one stage 3 block.
+stage2_shift = 9
+stage3_shift = 5
+
+max_code_point = 0x110000
+
+#=== Database ===#
+def properties(cp):
+    c = chr(cp)
+    result = list(categories).index(unicodedata.category(c))
+    # `str.isidentifier()` checks XID_Start (or '_') followed by XID_Continue.
+    if c.isidentifier() and c != '_':
+        result |= xid_start
+    if ('a' + c).isidentifier():
+        result |= xid_continue
+    if cp in white_space_code_points:
+        result |= white_space
+    return result
+
+# Splits the values into blocks of the given size, returns the unique blocks and the indices.
+def deduplicate(values, block_size):
+    blocks  = {}
+    indices = []
+    for i in range(0, len(values), block_size):
+        block = tuple(values[i:i + block_size])
+        indices.append(blocks.setdefault(block, len(blocks)))
+    return [value for block in blocks for value in block], indices
+
+def index_type(values):
+    return 'std::uint_least8_t' if max(values) < 256 else 'std::uint_least16_t'
+
+#=== Output ===#
+def write_array(output, type, name, values):
+    output.write(f'inline constexpr {type} {name}[] = {{\n')
+    line = '   '
+    for value in values:
+        entry = f' {value},'
+        if len(line) + len(entry) > 100:
+            output.write(line + '\n')
+            line = '   '
+        line += entry
+    output.write(line + '\n};\n\n')
+
+def main():
+    database = [properties(cp) for cp in range(max_code_point)]
+
+    stage3, leaf_indices = deduplicate(database, 1 << stage3_shift)
+    stage2, stage1       = deduplicate(leaf_indices, 1 << (stage2_shift - stage3_shift))
+
+    enumerators = ''.join(f'    {name}, // {description}\n'
+                          for name, description in categories.items())
+    stage2_size  = 1 << (stage2_shift - stage3_shift)
+    stage3_size  = 1 << stage3_shift
+    stage2_index = f'stage2 * {stage2_size}u + ((cp >> {stage3_shift}) & {stage2_size - 1}u)'
+
+    with open(output_path, 'w') as output:
+        output.write(f'''// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+// This file is generated by support/generate-unicode-database.py, do not edit.
+// Unicode version {unicodedata.unidata_version}.
+
+#ifndef LEXY_DETAIL_UNICODE_DATABASE_HPP_INCLUDED
+#define LEXY_DETAIL_UNICODE_DATABASE_HPP_INCLUDED
+
+#include <cstdint>
+#include <lexy/_detail/config.hpp>
+
+namespace lexy
+{{
+/// The general category of a code point.
+enum class unicode_category : std::uint_least8_t
+{{
+{enumerators}}};
+}} // namespace lexy
+
+namespace lexy::_detail
+{{
+// The bits in the byte of each code point.
+enum unicode_database_bits : std::uint_least8_t
+{{
+    unicode_database_category     = {hex(category_mask)},
+    unicode_database_xid_start    = {hex(xid_start)},
+    unicode_database_xid_continue = {hex(xid_continue)},
+    unicode_database_white_space  = {hex(white_space)},
+}};
+
+''')
+        write_array(output, index_type(stage1), 'unicode_database_stage1', stage1)
+        write_array(output, index_type(stage2), 'unicode_database_stage2', stage2)
+        write_array(output, 'std::uint_least8_t', 'unicode_database_stage3', stage3)
+        write_array(output, 'std::uint_least8_t', 'unicode_database_ascii', database[:128])
+
+        output.write(f'''// Returns the byte of the code point, which must be valid.
+constexpr std::uint_least8_t unicode_database_lookup(char32_t cp)
+{{
+    auto stage2 = unicode_database_stage1[cp >> {stage2_shift}];
+    auto stage3 = unicode_database_stage2[{stage2_index}];
+    return unicode_database_stage3[stage3 * {stage3_size}u + (cp & {stage3_size - 1}u)];
+}}
+}} // namespace lexy::_detail
+
+#endif // LEXY_DETAIL_UNICODE_DATABASE_HPP_INCLUDED
+''')
+
+if __name__ == '__main__':
+    if len(sys.argv) > 1:
+        print(f'usage: {sys.argv[0]}')
+        sys.exit(1)
+    main()
@@ -7,6 +7,7 @@
 #include <doctest/doctest.h>
 #include <lexy/input/string_input.hpp>
 #include <lexy/match.hpp>
+#include <lexy/parse_events.hpp>
 #include <lexy_ext/parse_tree_doctest.hpp>
 
 // We copy the conformance tests from https://github.com/miloyip/nativejson-benchmark.
@@ -663,3 +664,123 @@ TEST_CASE("roundtrip24")
 
 // roundtrip25-27 just test for precision/range, which aren't too interesting here
 
+//=== events ===//
+namespace
+{
+struct event_handler
+{
+    std::string events;
+
+    void start_object()
+    {
+        events += "{";
+    }
+    void end_object()
+    {
+        events += "}";
+    }
+    void start_array()
+    {
+        events += "[";
+    }
+    void end_array()
+    {
+        events += "]";
+    }
+
+    template <typename Lexeme>
+    void key(Lexeme lexeme)
+    {
+        events += "key(" + std::string(lexeme.begin(), lexeme.end()) + ")";
+    }
+    template <typename Lexeme>
+    void value(Lexeme lexeme)
+    {
+        events += "value(" + std::string(lexeme.begin(), lexeme.end()) + ")";
+    }
+};
+
+auto parse_events(const char* str)
+{
+    event_handler handler;
+    auto          visitor = events::json_visitor(handler);
+
+    auto input = lexy::zstring_input<lexy::utf8_encoding>(str);
+    REQUIRE(lexy::parse_events<grammar::json>(input, visitor, lexy::noop));
+    return handler.events;
+}
+} // namespace
+
+TEST_CASE("events")
+{
+    CHECK(parse_events(R"(null)") == "value(null)");
+    CHECK(parse_events(R"( "foo" )") == R"(value("foo"))");
+    CHECK(parse_events(R"([])") == "[]");
+    CHECK(parse_events(R"({})") == "{}");
+    CHECK(parse_events(R"([1 , true, "a\nb" ])") == R"([value(1)value(true)value("a\nb")])");
+    CHECK(parse_events(R"({"a": {"b": [1, {}], "c": -2.5e3}, "d" : false})")
+          == R"({key(a){key(b)[value(1){}]key(c)value(-2.5e3)}key(d)value(false)})");
+}
+
+TEST_CASE("query")
+{
+    auto extract = [](const char* str, std::initializer_list<const char*> paths,
+                      bool validate_skipped = false) {
+        query::path_set set;
+        for (auto path : paths)
+            set.add(path);
+
+        std::string result;
+        auto        callback = [&](std::size_t path, const ast::json_value& value) {
+            result += std::to_string(path);
+            result += '=';
+            if (auto str = std::get_if<ast::json_string>(&value.v))
+                result += *str;
+            else if (auto number = std::get_if<ast::json_number>(&value.v))
+                result += std::to_string(number->integer);
+            else if (auto array = std::get_if<ast::json_array>(&value.v))
+                result += "[" + std::to_string(array->size()) + "]";
+            else if (auto object = std::get_if<ast::json_object>(&value.v))
+                result += "{" + std::to_string(object->size()) + "}";
+            else
+                result += '?';
+            result += ';';
+        };
+
+        auto input = lexy::zstring_input<lexy::utf8_encoding>(str);
+        if (!query::extract(input, set, validate_skipped, callback, lexy::noop))
+            result += "error";
+        return result;
+    };
+
+    auto doc = R"({
+        "user": {"id": 42, "name": "Bob \"}]"},
+        "items": [{"price": 1, "tags": ["{", "}"]}, {"name": "x"}, {"price": 3}],
+        "empty": {}
+    })";
+
+    CHECK(extract(doc, {"/user/id"}) == "0=42;");
+    CHECK(extract(doc, {"/user/id", "/user/name"}) == "0=42;1=Bob \"}];");
+    CHECK(extract(doc, {"/items/*/price"}) == "0=1;0=3;");
+    CHECK(extract(doc, {"/items/1/name", "/items/1"}) == "1={1};0=x;");
+    CHECK(extract(doc, {"/user", "/empty", "/missing"}) == "0={2};1={0};");
+    CHECK(extract(doc, {"/user/id/x", "/items/*/tags/1"}) == "1=};");
+    CHECK(extract(doc, {"/user/id"}, true) == "0=42;");
+
+    // Keys are compared with escape sequences replaced.
+    auto escaped = R"({"a\"b": 1, "c": {"d\u0065": 2}})";
+    CHECK(extract(escaped, {"/a\"b", "/c/de"}) == "0=1;1=2;");
+    CHECK(extract(escaped, {"/c", "/c/de"}) == "0={1};1=2;");
+    CHECK(extract(R"([1E5, "\\", "a\"]", 2])", {"/3"}) == "0=2;");
+
+    // Skipped values are only validated on request.
+    auto invalid = R"({"a": [01, tru], "b": 1})";
+    CHECK(extract(invalid, {"/b"}) == "0=1;");
+    CHECK(extract(invalid, {"/b"}, true) == "0=1;error");
+    CHECK(extract(invalid, {"/a"}) == "error");
+
+    // The structure is always checked.
+    CHECK(extract(R"({"a": [1, "]}, "b": 1})", {"/b"}) == "error");
+    CHECK(extract(R"({"a" 1})", {"/a"}) == "error");
+}
+
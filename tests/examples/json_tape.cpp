@@ -0,0 +1,118 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include "../../examples/json_tape.cpp"
+
+#include <doctest/doctest.h>
+#include <lexy/input/string_input.hpp>
+
+namespace
+{
+bool parse(tape::json_tape& tape, const char* str)
+{
+    auto input = lexy::zstring_input<lexy::utf8_encoding>(str);
+    return static_cast<bool>(parse_json(tape, input, lexy::noop));
+}
+} // namespace
+
+TEST_CASE("pass/fail")
+{
+    tape::json_tape tape;
+    CHECK(parse(tape, R"([1, 2.5, "abc", true, false, null, {}, []])"));
+    CHECK(parse(tape, R"({"a": {"b": [1, {"c": "d"}]}})"));
+    CHECK(parse(tape, R"(  "top-level string"  )"));
+
+    CHECK(!parse(tape, R"(["Unclosed array")"));
+    CHECK(!parse(tape, R"({unquoted_key: "keys must be quoted"})"));
+    CHECK(!parse(tape, R"(["extra comma",])"));
+    CHECK(!parse(tape, R"([0123])"));
+    CHECK(!parse(tape, R"([1e])"));
+}
+
+TEST_CASE("primitives")
+{
+    tape::json_tape tape;
+    REQUIRE(parse(tape, R"([null, true, false, 42, -7, 1.5, -2.5e3, 1E2])"));
+
+    CHECK(tape.tag_at(0) == tape::tag::array_begin);
+    CHECK(tape.container_size(0) == 8);
+    CHECK(tape.container_end(0) == tape.size() - 1);
+    CHECK(tape.tag_at(tape.size() - 1) == tape::tag::array_end);
+
+    auto idx = std::size_t(1);
+    CHECK(tape.tag_at(idx) == tape::tag::null);
+    idx = tape.next(idx);
+    CHECK(tape.tag_at(idx) == tape::tag::true_);
+    idx = tape.next(idx);
+    CHECK(tape.tag_at(idx) == tape::tag::false_);
+    idx = tape.next(idx);
+    CHECK(tape.tag_at(idx) == tape::tag::integer);
+    CHECK(tape.integer(idx) == 42);
+    idx = tape.next(idx);
+    CHECK(tape.tag_at(idx) == tape::tag::integer);
+    CHECK(tape.integer(idx) == -7);
+    idx = tape.next(idx);
+    CHECK(tape.tag_at(idx) == tape::tag::real);
+    CHECK(tape.real(idx) == 1.5);
+    idx = tape.next(idx);
+    CHECK(tape.tag_at(idx) == tape::tag::real);
+    CHECK(tape.real(idx) == -2500);
+    idx = tape.next(idx);
+    CHECK(tape.tag_at(idx) == tape::tag::real);
+    CHECK(tape.real(idx) == 100);
+    idx = tape.next(idx);
+    CHECK(idx == tape.container_end(0));
+}
+
+TEST_CASE("strings")
+{
+    tape::json_tape tape;
+    auto            parse_string = [&](const char* str) {
+        REQUIRE(parse(tape, str));
+        return std::string(tape.string(0));
+    };
+
+    CHECK(parse_string(R"("")") == "");
+    CHECK(tape.tag_at(0) == tape::tag::string);
+    CHECK(parse_string(R"("Hello")") == "Hello");
+    CHECK(tape.tag_at(0) == tape::tag::string);
+
+    CHECK(parse_string(R"("Hello\nWorld")") == "Hello\nWorld");
+    CHECK(tape.tag_at(0) == tape::tag::escaped_string);
+    CHECK(parse_string(R"("Hello\u0000World")") == std::string("Hello\0World", 11));
+    CHECK(parse_string(R"("\"\\\/\b\f\n\r\t")") == "\"\\/\b\f\n\r\t");
+    CHECK(parse_string(R"("\u0024")") == "\u0024");
+    CHECK(parse_string(R"("\u00A2")") == "\u00A2");
+    CHECK(parse_string(R"("\u20AC")") == "\u20AC");
+}
+
+TEST_CASE("object")
+{
+    tape::json_tape tape;
+    REQUIRE(parse(tape, R"({"a": [1, 2], "b\tc": {}, "d": "e"})"));
+
+    CHECK(tape.tag_at(0) == tape::tag::object_begin);
+    CHECK(tape.container_size(0) == 3);
+
+    auto key = std::size_t(1);
+    CHECK(tape.string(key) == "a");
+    auto value = tape.next(key);
+    CHECK(tape.tag_at(value) == tape::tag::array_begin);
+    CHECK(tape.container_size(value) == 2);
+    CHECK(tape.tag_at(tape.container_end(value)) == tape::tag::array_end);
+
+    key = tape.next(value);
+    CHECK(tape.tag_at(key) == tape::tag::escaped_string);
+    CHECK(tape.string(key) == "b\tc");
+    value = tape.next(key);
+    CHECK(tape.tag_at(value) == tape::tag::object_begin);
+    CHECK(tape.container_size(value) == 0);
+    CHECK(tape.container_end(value) == value + 1);
+
+    key = tape.next(value);
+    CHECK(tape.string(key) == "d");
+    value = tape.next(key);
+    CHECK(tape.string(value) == "e");
+    CHECK(tape.next(value) == tape.container_end(0));
+}
@@ -7,6 +7,7 @@
 #include <doctest/doctest.h>
 #include <lexy/input/string_input.hpp>
 #include <lexy/match.hpp>
+#include <lexy/parse_events.hpp>
 
 namespace
 {
@@ -122,3 +123,56 @@ TEST_CASE("text")
     fail(R"(<hello>1 < 2</hello>)");
 }
 
+//=== events ===//
+namespace
+{
+struct event_handler
+{
+    std::string events;
+
+    template <typename Lexeme>
+    void start_element(Lexeme name)
+    {
+        events += "<" + std::string(name.begin(), name.end()) + ">";
+    }
+    void end_element()
+    {
+        events += "</>";
+    }
+
+    template <typename Lexeme>
+    void text(Lexeme lexeme)
+    {
+        events += "text(" + std::string(lexeme.begin(), lexeme.end()) + ")";
+    }
+    template <typename Lexeme>
+    void reference(Lexeme lexeme)
+    {
+        events += "reference(" + std::string(lexeme.begin(), lexeme.end()) + ")";
+    }
+    template <typename Lexeme>
+    void cdata(Lexeme lexeme)
+    {
+        events += "cdata(" + std::string(lexeme.begin(), lexeme.end()) + ")";
+    }
+};
+
+auto parse_events(const char* str)
+{
+    event_handler handler;
+    auto          visitor = events::xml_visitor(handler);
+
+    auto input = lexy::zstring_input<lexy::utf8_encoding>(str);
+    REQUIRE(lexy::parse_events<grammar::document>(input, visitor, lexy::noop));
+    return handler.events;
+}
+} // namespace
+
+TEST_CASE("events")
+{
+    CHECK(parse_events(R"(<hello/>)") == "<hello></>");
+    CHECK(parse_events(R"(<hello>World</hello>)") == "<hello>text(World)</>");
+    CHECK(parse_events(R"(<!-- a --><a>1 &lt; 2<b><![CDATA[ <c> ]]></b><!-- b --></a>)")
+          == "<a>text(1 )reference(&lt;)text( 2)<b>cdata( <c> )</></>");
+}
+
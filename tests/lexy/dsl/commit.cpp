@@ -0,0 +1,31 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/dsl/commit.hpp>
+
+#include "verify.hpp"
+
+TEST_CASE("dsl::commit")
+{
+    static constexpr auto rule = lexy::dsl::commit;
+    CHECK(lexy::is_rule<decltype(rule)>);
+
+    struct callback
+    {
+        const char* str;
+
+        LEXY_VERIFY_FN int success(const char* cur)
+        {
+            LEXY_VERIFY_CHECK(cur == str);
+            return 0;
+        }
+    };
+
+    // Regular inputs can't discard anything, so it does nothing.
+    auto empty = LEXY_VERIFY("");
+    CHECK(empty == 0);
+
+    auto string = LEXY_VERIFY("abc");
+    CHECK(string == 0);
+}
@@ -0,0 +1,88 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/dsl/lazy.hpp>
+
+#include "verify.hpp"
+#include <lexy/dsl/ascii.hpp>
+#include <lexy/dsl/capture.hpp>
+#include <lexy/dsl/eof.hpp>
+#include <lexy/dsl/while.hpp>
+#include <string>
+
+namespace
+{
+struct body
+{
+    static constexpr auto rule
+        = lexy::dsl::capture(lexy::dsl::while_(lexy::dsl::ascii::alpha)) + lexy::dsl::eof;
+    static constexpr auto value = lexy::as_string<std::string>;
+};
+
+using lazy_body = lexy::lazy_production<body, lexy::input_reader<test_input>>;
+} // namespace
+
+TEST_CASE("dsl::lazy")
+{
+    static constexpr auto rule = lexy::dsl::lazy<body>(lexy::dsl::curly_bracketed);
+    CHECK(lexy::is_rule<decltype(rule)>);
+    CHECK(lexy::is_branch<decltype(rule)>);
+
+    struct callback
+    {
+        const char* str;
+
+        LEXY_VERIFY_FN int success(const char* cur, lazy_body handle)
+        {
+            LEXY_VERIFY_CHECK(handle.lexeme().begin() == str + 1);
+            LEXY_VERIFY_CHECK(handle.lexeme().end() == cur - 1);
+            return int(handle.lexeme().size());
+        }
+
+        LEXY_VERIFY_FN int error(test_error<lexy::expected_literal> e)
+        {
+            if (e.string() == lexy::_detail::string_view("{"))
+                return -1;
+            else if (e.string() == lexy::_detail::string_view("}"))
+                return -2;
+            else
+                LEXY_VERIFY_CHECK(false);
+            return -42;
+        }
+    };
+
+    auto empty = LEXY_VERIFY("");
+    CHECK(empty == -1);
+
+    auto zero = LEXY_VERIFY("{}");
+    CHECK(zero == 0);
+    auto content = LEXY_VERIFY("{abc}");
+    CHECK(content == 3);
+    auto nested = LEXY_VERIFY("{a{b}{{c}}d}");
+    CHECK(nested == 10);
+    auto trailing = LEXY_VERIFY("{a}b}");
+    CHECK(trailing == 1);
+
+    auto unterminated = LEXY_VERIFY("{abc");
+    CHECK(unterminated == -2);
+    auto unbalanced = LEXY_VERIFY("{a{bc}");
+    CHECK(unbalanced == -2);
+}
+
+TEST_CASE("lazy_production")
+{
+    auto input  = lexy::zstring_input<test_encoding>("abc");
+    auto handle = lazy_body(input.begin(), input.end());
+    CHECK(handle.lexeme().size() == 3);
+    CHECK(handle.input().begin() == input.begin());
+    CHECK(handle.input().end() == input.end());
+
+    auto result = handle.parse(lexy::noop);
+    REQUIRE(result);
+    CHECK(result.value() == "abc");
+
+    auto error_input  = lexy::zstring_input<test_encoding>("a1c");
+    auto error_handle = lazy_body(error_input.begin(), error_input.end());
+    CHECK(!error_handle.parse(lexy::noop));
+}
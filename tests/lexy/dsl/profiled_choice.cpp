@@ -0,0 +1,161 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/dsl/profiled_choice.hpp>
+
+#include "verify.hpp"
+#include <lexy/dsl/label.hpp>
+#include <lexy/dsl/peek.hpp>
+
+namespace
+{
+struct unprofiled;
+struct disjoint;
+struct overlapping;
+struct barrier;
+
+template <typename Rule, std::size_t N>
+constexpr bool has_order(Rule, const std::size_t (&expected)[N])
+{
+    for (auto i = std::size_t(0); i != N; ++i)
+        if (Rule::_order.index[i] != expected[i])
+            return false;
+    return true;
+}
+
+struct id_callback
+{
+    const char* str;
+
+    template <int Id>
+    LEXY_VERIFY_FN int success(const char*, lexy::id<Id>)
+    {
+        return Id;
+    }
+
+    LEXY_VERIFY_FN int error(test_error<lexy::exhausted_choice> e)
+    {
+        LEXY_VERIFY_CHECK(e.position() == str);
+        return -1;
+    }
+};
+} // namespace
+
+template <>
+struct lexy::choice_profile<disjoint>
+{
+    static constexpr std::uint64_t hits[] = {1, 5, 10};
+};
+template <>
+struct lexy::choice_profile<overlapping>
+{
+    static constexpr std::uint64_t hits[] = {1, 10};
+};
+template <>
+struct lexy::choice_profile<barrier>
+{
+    static constexpr std::uint64_t hits[] = {1, 5, 100, 1, 10, 5};
+};
+
+TEST_CASE("dsl::profiled_choice")
+{
+    SUBCASE("unprofiled")
+    {
+        static constexpr auto rule = lexy::dsl::profiled_choice<unprofiled>(
+            LEXY_LIT("abc") >> lexy::dsl::id<0> | LEXY_LIT("def") >> lexy::dsl::id<1>);
+        CHECK(lexy::is_rule<decltype(rule)>);
+        CHECK(has_order(rule, {0, 1}));
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char* cur, lexy::id<0>)
+            {
+                auto match = lexy::_detail::string_view(str, cur);
+                LEXY_VERIFY_CHECK(match == "abc");
+                return 0;
+            }
+            LEXY_VERIFY_FN int success(const char* cur, lexy::id<1>)
+            {
+                auto match = lexy::_detail::string_view(str, cur);
+                LEXY_VERIFY_CHECK(match == "def");
+                return 1;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::exhausted_choice> e)
+            {
+                LEXY_VERIFY_CHECK(e.position() == str);
+                return -1;
+            }
+        };
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty == -1);
+
+        auto abc = LEXY_VERIFY("abc");
+        CHECK(abc == 0);
+        auto def = LEXY_VERIFY("def");
+        CHECK(def == 1);
+    }
+    SUBCASE("disjoint")
+    {
+        static constexpr auto rule = lexy::dsl::profiled_choice<disjoint>(
+            LEXY_LIT("abc") >> lexy::dsl::id<0> | LEXY_LIT("abd") >> lexy::dsl::id<1>
+            | LEXY_LIT("x") >> lexy::dsl::id<2>);
+        CHECK(lexy::is_rule<decltype(rule)>);
+        CHECK(has_order(rule, {2, 1, 0}));
+
+        using callback = id_callback;
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty == -1);
+        auto ab = LEXY_VERIFY("ab");
+        CHECK(ab == -1);
+
+        auto abc = LEXY_VERIFY("abc");
+        CHECK(abc == 0);
+        auto abd = LEXY_VERIFY("abd");
+        CHECK(abd == 1);
+        auto x = LEXY_VERIFY("x");
+        CHECK(x == 2);
+    }
+    SUBCASE("overlapping")
+    {
+        // "a" is a prefix of "abc", so reordering would change the result.
+        static constexpr auto rule = lexy::dsl::profiled_choice<overlapping>(
+            LEXY_LIT("a") >> lexy::dsl::id<0> | LEXY_LIT("abc") >> lexy::dsl::id<1>);
+        CHECK(lexy::is_rule<decltype(rule)>);
+        CHECK(has_order(rule, {0, 1}));
+
+        using callback = id_callback;
+
+        auto abc = LEXY_VERIFY("abc");
+        CHECK(abc == 0);
+    }
+    SUBCASE("barrier")
+    {
+        // Only the runs of literals are reordered, the other branches stay in place.
+        static constexpr auto rule = lexy::dsl::profiled_choice<barrier>(
+            LEXY_LIT("a") >> lexy::dsl::id<0> | LEXY_LIT("b") >> lexy::dsl::id<1>
+            | lexy::dsl::peek(LEXY_LIT("c")) >> lexy::dsl::id<2>
+            | LEXY_LIT("c") >> lexy::dsl::id<3> | LEXY_LIT("d") >> lexy::dsl::id<4>
+            | lexy::dsl::else_ >> lexy::dsl::id<5>);
+        CHECK(lexy::is_rule<decltype(rule)>);
+        CHECK(has_order(rule, {1, 0, 2, 4, 3, 5}));
+
+        using callback = id_callback;
+
+        auto a = LEXY_VERIFY("a");
+        CHECK(a == 0);
+        auto b = LEXY_VERIFY("b");
+        CHECK(b == 1);
+        auto c = LEXY_VERIFY("c");
+        CHECK(c == 2);
+        auto d = LEXY_VERIFY("d");
+        CHECK(d == 4);
+        auto e = LEXY_VERIFY("e");
+        CHECK(e == 5);
+    }
+}
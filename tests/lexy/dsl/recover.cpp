@@ -88,6 +88,38 @@ TEST_CASE("dsl::find")
         auto limited = LEXY_VERIFY("--$!");
         CHECK(!limited.recovered);
     }
+    SUBCASE("literals")
+    {
+        static constexpr auto rule
+            = lexy::dsl::find(LEXY_LIT("if"), LEXY_LIT("else"), LEXY_LIT("end"))
+                  .limit(LEXY_LIT(";"));
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char* cur)
+            {
+                return int(cur - str);
+            }
+        };
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(!empty.recovered);
+
+        auto if0 = LEXY_VERIFY("if");
+        CHECK(if0 == 0);
+        auto else4 = LEXY_VERIFY("e i else");
+        CHECK(else4 == 4);
+        auto end = LEXY_VERIFY("x = en + end");
+        CHECK(end == 9);
+
+        auto missing = LEXY_VERIFY("x = e");
+        CHECK(!missing.recovered);
+        auto limited = LEXY_VERIFY("x = e; if");
+        CHECK(!limited.recovered);
+    }
 }
 
 TEST_CASE("dsl::recover_")
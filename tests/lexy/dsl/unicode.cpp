@@ -0,0 +1,217 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/dsl/unicode.hpp>
+
+#include "verify.hpp"
+#include <lexy/dsl/identifier.hpp>
+
+namespace
+{
+template <typename Predicate>
+constexpr bool matches(char32_t cp)
+{
+    return Predicate{}(lexy::code_point(cp));
+}
+} // namespace
+
+TEST_CASE("unicode database")
+{
+    using cat = lexy::unicode_category;
+    auto category
+        = [](char32_t cp) { return cat(lexy::_detail::unicode_database_lookup(cp) & 0x1F); };
+    CHECK(category(U'a') == cat::Ll);
+    CHECK(category(U'A') == cat::Lu);
+    CHECK(category(U'0') == cat::Nd);
+    CHECK(category(U'_') == cat::Pc);
+    CHECK(category(U'\n') == cat::Cc);
+    CHECK(category(U'ǅ') == cat::Lt);
+    CHECK(category(U'中') == cat::Lo);
+    CHECK(category(0x0301) == cat::Mn);
+    CHECK(category(U'€') == cat::Sc);
+    CHECK(category(0x2028) == cat::Zl);
+    CHECK(category(0xD800) == cat::Cs);
+    CHECK(category(0xE000) == cat::Co);
+    CHECK(category(0x0378) == cat::Cn);
+    CHECK(category(0x10FFFF) == cat::Cn);
+    CHECK(category(0x1F600) == cat::So);
+
+    for (auto c = 0u; c != 0x80; ++c)
+        CHECK(lexy::_detail::unicode_database_ascii[c]
+              == lexy::_detail::unicode_database_lookup(char32_t(c)));
+}
+
+TEST_CASE("dsl::unicode predicates")
+{
+    using namespace lexy::dsl::unicode;
+
+    CHECK(matches<_control>(U'\t'));
+    CHECK(!matches<_control>(U' '));
+
+    CHECK(matches<_upper>(U'Σ'));
+    CHECK(!matches<_upper>(U'σ'));
+    CHECK(matches<_lower>(U'σ'));
+    CHECK(matches<_alpha>(U'中'));
+    CHECK(!matches<_alpha>(U'1'));
+    CHECK(matches<_digit>(U'٣'));
+    CHECK(!matches<_digit>(U'Ⅻ'));
+    CHECK(matches<_alnum>(U'٣'));
+    CHECK(matches<_alnum>(U'ä'));
+    CHECK(matches<_punct>(U'«'));
+    CHECK(!matches<_punct>(U'+'));
+
+    CHECK(matches<_space>(U' '));
+    CHECK(matches<_space>(0x00A0));
+    CHECK(matches<_space>(0x3000));
+    CHECK(!matches<_space>(0x200B));
+
+    CHECK(matches<_xid_start>(U'ä'));
+    CHECK(!matches<_xid_start>(U'_'));
+    CHECK(!matches<_xid_start>(0x0301));
+    CHECK(matches<_xid_start_underscore>(U'_'));
+    CHECK(matches<_xid_continue>(U'_'));
+    CHECK(matches<_xid_continue>(0x0301));
+    CHECK(!matches<_xid_continue>(U'-'));
+
+    CHECK(matches<_category<lexy::unicode_category::Sc, lexy::unicode_category::Sm>>(U'€'));
+    CHECK(matches<_category<lexy::unicode_category::Sc, lexy::unicode_category::Sm>>(U'+'));
+    CHECK(!matches<_category<lexy::unicode_category::Sc, lexy::unicode_category::Sm>>(U'a'));
+
+    // The ASCII fast path agrees with the database.
+    for (auto c = 0u; c != 0x80; ++c)
+    {
+        CHECK(_xid_continue::_match_ascii(char32_t(c)) == matches<_xid_continue>(char32_t(c)));
+        CHECK(_space::_match_ascii(char32_t(c)) == matches<_space>(char32_t(c)));
+    }
+}
+
+TEST_CASE("dsl::unicode::xid_start")
+{
+    static constexpr auto rule = lexy::dsl::unicode::xid_start;
+    CHECK(lexy::is_rule<decltype(rule)>);
+    CHECK(lexy::is_token<decltype(rule)>);
+
+    struct callback
+    {
+        const LEXY_CHAR8_T* str;
+
+        LEXY_VERIFY_FN int success(const LEXY_CHAR8_T* cur)
+        {
+            return int(cur - str);
+        }
+
+        LEXY_VERIFY_FN int error(
+            lexy::string_error<lexy::expected_char_class, lexy::utf8_encoding> e)
+        {
+            LEXY_VERIFY_CHECK(e.position() == str);
+            if (e.character_class() == lexy::_detail::string_view("UTF-8.code_point"))
+                return -2;
+
+            LEXY_VERIFY_CHECK(e.character_class()
+                              == lexy::_detail::string_view("Unicode.XID-start"));
+            return -1;
+        }
+    };
+
+    auto empty = LEXY_VERIFY_ENCODING(lexy::utf8_encoding, LEXY_CHAR8_STR(""));
+    CHECK(empty == -2);
+
+    auto ascii = LEXY_VERIFY_ENCODING(lexy::utf8_encoding, LEXY_CHAR8_STR("a"));
+    CHECK(ascii == 1);
+    auto ascii_bad = LEXY_VERIFY_ENCODING(lexy::utf8_encoding, LEXY_CHAR8_STR("1"));
+    CHECK(ascii_bad == -1);
+
+    auto two = LEXY_VERIFY_ENCODING(lexy::utf8_encoding, LEXY_CHAR8_STR("ä"));
+    CHECK(two == 2);
+    auto three = LEXY_VERIFY_ENCODING(lexy::utf8_encoding, LEXY_CHAR8_STR("中"));
+    CHECK(three == 3);
+    auto bad = LEXY_VERIFY_ENCODING(lexy::utf8_encoding, LEXY_CHAR8_STR("\xCC\x81"));
+    CHECK(bad == -1);
+
+    auto invalid = LEXY_VERIFY_ENCODING(lexy::utf8_encoding, LEXY_CHAR8_STR("\x80"));
+    CHECK(invalid == -2);
+}
+
+TEST_CASE("dsl::unicode::space")
+{
+    static constexpr auto rule = lexy::dsl::unicode::space.capture();
+    CHECK(lexy::is_rule<decltype(rule)>);
+
+    struct callback
+    {
+        const char32_t* str;
+
+        LEXY_VERIFY_FN int success(const char32_t* cur, lexy::code_point cp)
+        {
+            LEXY_VERIFY_CHECK(cur == str + 1);
+            return int(cp.value());
+        }
+
+        LEXY_VERIFY_FN int error(
+            lexy::string_error<lexy::expected_char_class, lexy::utf32_encoding> e)
+        {
+            LEXY_VERIFY_CHECK(e.position() == str);
+            return -1;
+        }
+    };
+
+    auto empty = LEXY_VERIFY_ENCODING(lexy::utf32_encoding, U"");
+    CHECK(empty == -1);
+
+    auto ascii = LEXY_VERIFY_ENCODING(lexy::utf32_encoding, U" ");
+    CHECK(ascii == ' ');
+    auto ideographic = LEXY_VERIFY_ENCODING(lexy::utf32_encoding, U"\u3000");
+    CHECK(ideographic == 0x3000);
+    auto bad = LEXY_VERIFY_ENCODING(lexy::utf32_encoding, U"a");
+    CHECK(bad == -1);
+}
+
+TEST_CASE("dsl::identifier with Unicode")
+{
+    static constexpr auto rule
+        = lexy::dsl::identifier(lexy::dsl::unicode::xid_start_underscore,
+                                lexy::dsl::unicode::xid_continue);
+
+    struct callback
+    {
+        const LEXY_CHAR8_T* str;
+
+        LEXY_VERIFY_FN int success(const LEXY_CHAR8_T*,
+                                   lexy::string_lexeme<lexy::utf8_encoding> lex)
+        {
+            LEXY_VERIFY_CHECK(lex.begin() == str);
+            return int(lex.size());
+        }
+
+        LEXY_VERIFY_FN int error(
+            lexy::string_error<lexy::expected_char_class, lexy::utf8_encoding> e)
+        {
+            LEXY_VERIFY_CHECK(e.position() == str);
+            return -1;
+        }
+    };
+
+    auto empty = LEXY_VERIFY_ENCODING(lexy::utf8_encoding, LEXY_CHAR8_STR(""));
+    CHECK(empty == -1);
+
+    auto ascii = LEXY_VERIFY_ENCODING(lexy::utf8_encoding, LEXY_CHAR8_STR("_foo_bar42 + 1"));
+    CHECK(ascii == 10);
+    auto long_ascii
+        = LEXY_VERIFY_ENCODING(lexy::utf8_encoding, LEXY_CHAR8_STR("abcdefghijklmnopqrstuvwxyz"));
+    CHECK(long_ascii == 26);
+    auto mixed
+        = LEXY_VERIFY_ENCODING(lexy::utf8_encoding, LEXY_CHAR8_STR("straßenname_löschen = 1"));
+    CHECK(mixed == 21);
+    auto combining
+        = LEXY_VERIFY_ENCODING(lexy::utf8_encoding, LEXY_CHAR8_STR("e\xCC\x81t\xC3\xA9 "));
+    CHECK(combining == 6);
+    auto cjk = LEXY_VERIFY_ENCODING(lexy::utf8_encoding, LEXY_CHAR8_STR("变量名　"));
+    CHECK(cjk == 9);
+    auto invalid = LEXY_VERIFY_ENCODING(lexy::utf8_encoding, LEXY_CHAR8_STR("abcdefghij\x80"));
+    CHECK(invalid == 10);
+
+    auto bad = LEXY_VERIFY_ENCODING(lexy::utf8_encoding, LEXY_CHAR8_STR("1abc"));
+    CHECK(bad == -1);
+}
+
@@ -6,6 +6,7 @@
 
 #include "verify.hpp"
 #include <lexy/_detail/nttp_string.hpp>
+#include <lexy/input/instrumented_input.hpp>
 
 TEST_CASE("engine_cp_ascii")
 {
@@ -479,3 +480,105 @@ TEST_CASE("engine_cp_auto")
     }
 }
 
+namespace
+{
+// Lowercase ASCII letters and 'ä', 'ö', 'ü'.
+struct cp_while_predicate
+{
+    constexpr bool operator()(lexy::code_point cp) const
+    {
+        return (cp.value() >= 'a' && cp.value() <= 'z') || cp.value() == 0xE4
+               || cp.value() == 0xF6 || cp.value() == 0xFC;
+    }
+};
+
+struct cp_while_ascii_predicate : cp_while_predicate
+{
+    static constexpr bool _match_ascii(char32_t c)
+    {
+        return c >= 'a' && c <= 'z';
+    }
+};
+
+template <typename Predicate>
+void check_cp_while()
+{
+    using engine = lexy::engine_cp_while<Predicate>;
+    CHECK(lexy::engine_is_matcher<engine>);
+    CHECK(!lexy::engine_can_fail<engine, lexy::_detail::range_reader<lexy::utf8_encoding,
+                                                                    const LEXY_CHAR8_T*>>);
+
+    auto empty = engine_matches<engine, lexy::utf8_encoding>(LEXY_CHAR8_STR(""));
+    CHECK(empty);
+    CHECK(empty.count == 0);
+
+    auto none = engine_matches<engine, lexy::utf8_encoding>(LEXY_CHAR8_STR("A"));
+    CHECK(none);
+    CHECK(none.count == 0);
+
+    auto short_ascii = engine_matches<engine, lexy::utf8_encoding>(LEXY_CHAR8_STR("abc1"));
+    CHECK(short_ascii);
+    CHECK(short_ascii.count == 3);
+
+    // Longer than a single word, so ends in the middle of one.
+    auto long_ascii
+        = engine_matches<engine, lexy::utf8_encoding>(LEXY_CHAR8_STR("abcdefghijklm nop"));
+    CHECK(long_ascii);
+    CHECK(long_ascii.count == 13);
+    auto all_ascii
+        = engine_matches<engine, lexy::utf8_encoding>(LEXY_CHAR8_STR("abcdefghijklmnop"));
+    CHECK(all_ascii);
+    CHECK(all_ascii.count == 16);
+
+    auto mixed
+        = engine_matches<engine, lexy::utf8_encoding>(LEXY_CHAR8_STR("abcdefgäöühijklmnopä!"));
+    CHECK(mixed);
+    CHECK(mixed.count == 24);
+    auto bad_non_ascii
+        = engine_matches<engine, lexy::utf8_encoding>(LEXY_CHAR8_STR("abcdefghijkß"));
+    CHECK(bad_non_ascii);
+    CHECK(bad_non_ascii.count == 11);
+    auto invalid
+        = engine_matches<engine, lexy::utf8_encoding>(LEXY_CHAR8_STR("abcdefghijk\x80lmn"));
+    CHECK(invalid);
+    CHECK(invalid.count == 11);
+
+    auto ascii = engine_matches<engine, lexy::ascii_encoding>("abcdefghijk\x80lmn");
+    CHECK(ascii);
+    CHECK(ascii.count == 11);
+    auto utf16 = engine_matches<engine, lexy::utf16_encoding>(u"abcäöüdefghijkl!");
+    CHECK(utf16);
+    CHECK(utf16.count == 15);
+    auto utf32 = engine_matches<engine, lexy::utf32_encoding>(U"abcäöüdefghijkl!");
+    CHECK(utf32);
+    CHECK(utf32.count == 15);
+
+    // A reader that can't process a run at once.
+    auto string = lexy::zstring_input<lexy::utf8_encoding>(LEXY_CHAR8_STR("abcdefghijäklm nop"));
+    auto input  = lexy::instrumented_input(string);
+    auto reader = input.reader();
+    engine::match(reader);
+    CHECK(reader.cur() - string.reader().cur() == 15);
+}
+} // namespace
+
+TEST_CASE("engine_cp_while")
+{
+    SUBCASE("without ASCII fast path")
+    {
+        check_cp_while<cp_while_predicate>();
+    }
+    SUBCASE("with ASCII fast path")
+    {
+        check_cp_while<cp_while_ascii_predicate>();
+    }
+    SUBCASE("any code point")
+    {
+        using engine = lexy::engine_cp_while<void>;
+
+        auto result = engine_matches<engine, lexy::utf8_encoding>(LEXY_CHAR8_STR("abc ä\x80"));
+        CHECK(result);
+        CHECK(result.count == 6);
+    }
+}
+
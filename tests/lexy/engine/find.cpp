@@ -6,12 +6,16 @@
 
 #include "verify.hpp"
 #include <lexy/_detail/nttp_string.hpp>
+#include <lexy/engine/eof.hpp>
 #include <lexy/engine/literal.hpp>
+#include <lexy/engine/trie.hpp>
 
 namespace
 {
 constexpr auto trie_ab    = lexy::linear_trie<LEXY_NTTP_STRING("ab")>;
 constexpr auto trie_limit = lexy::linear_trie<LEXY_NTTP_STRING("!")>;
+constexpr auto trie_keywords
+    = lexy::trie<char, LEXY_NTTP_STRING("if"), LEXY_NTTP_STRING("else"), LEXY_NTTP_STRING("end")>;
 } // namespace
 
 TEST_CASE("engine_find")
@@ -98,3 +102,61 @@ TEST_CASE("engine_find_before")
     CHECK(limited.ec == engine::error_code::not_found_limit);
 }
 
+TEST_CASE("engine_find multiple strings")
+{
+    using condition = lexy::engine_trie<trie_keywords>;
+    CHECK(lexy::engine_has_start_filter<condition, lexy::default_encoding>);
+    CHECK(condition::can_start_with<lexy::default_encoding>('i'));
+    CHECK(condition::can_start_with<lexy::default_encoding>('e'));
+    CHECK(!condition::can_start_with<lexy::default_encoding>('f'));
+    CHECK(!condition::can_start_with<lexy::default_encoding>(lexy::default_encoding::eof()));
+
+    SUBCASE("engine_find")
+    {
+        using engine = lexy::engine_find<condition>;
+
+        auto empty = engine_matches<engine>("");
+        CHECK(!empty);
+        CHECK(empty.count == 0);
+
+        auto zero = engine_matches<engine>("else");
+        CHECK(zero);
+        CHECK(zero.count == 0);
+
+        auto skipped = engine_matches<engine>("a = b; i = 0; e = 1; end");
+        CHECK(skipped);
+        CHECK(skipped.count == 21);
+
+        auto unterminated = engine_matches<engine>("a = b; i = 0; e = 1;");
+        CHECK(!unterminated);
+        CHECK(unterminated.count == 20);
+        CHECK(unterminated.ec == engine::error_code::not_found);
+    }
+    SUBCASE("engine_find_before")
+    {
+        using engine = lexy::engine_find_before<condition, lexy::engine_literal<trie_limit>>;
+
+        auto skipped = engine_matches<engine>("a = b; i = 0; e = 1; if");
+        CHECK(skipped);
+        CHECK(skipped.count == 21);
+
+        auto limited = engine_matches<engine>("a = b; i = 0! e = 1; if");
+        CHECK(!limited);
+        CHECK(limited.count == 12);
+        CHECK(limited.ec == engine::error_code::not_found_limit);
+    }
+    SUBCASE("engine_find_before eof")
+    {
+        using engine = lexy::engine_find_before<condition, lexy::engine_eof>;
+
+        auto skipped = engine_matches<engine>("a = b; if");
+        CHECK(skipped);
+        CHECK(skipped.count == 7);
+
+        auto unterminated = engine_matches<engine>("a = b;");
+        CHECK(!unterminated);
+        CHECK(unterminated.count == 6);
+        CHECK(unterminated.ec == engine::error_code::not_found_eof);
+    }
+}
+
@@ -24,3 +24,80 @@ TEST_CASE("error_context")
     CHECK(context.position() == input.begin());
 }
 
+TEST_CASE("compact_error")
+{
+    struct production
+    {
+        static LEXY_CONSTEVAL auto name()
+        {
+            return "production";
+        }
+    };
+    struct other_production
+    {};
+    struct tag
+    {};
+
+    auto input   = lexy::zstring_input("abcdef");
+    auto context = lexy::error_context(production{}, input, input.begin() + 1);
+
+    SUBCASE("generic")
+    {
+        auto error = lexy::string_error<tag>(input.begin() + 2, input.begin() + 4);
+        auto compact = lexy::compact_error<decltype(input)>(context, error);
+        CHECK(compact.offset() == 2);
+        CHECK(compact.length() == 2);
+        CHECK(compact.production_offset() == 1);
+        CHECK(compact.is<tag>());
+        CHECK(!compact.is<lexy::expected_literal>());
+        CHECK(compact.is_in<production>());
+        CHECK(!compact.is_in<other_production>());
+        CHECK(compact.message() == lexy::_detail::string_view(error.message()));
+        CHECK(compact.production() == lexy::_detail::string_view("production"));
+
+        auto materialized = compact.materialize_error<tag>(input);
+        CHECK(materialized.begin() == error.begin());
+        CHECK(materialized.end() == error.end());
+
+        auto ctx = compact.materialize_context<production>(input);
+        CHECK(&ctx.input() == &input);
+        CHECK(ctx.position() == context.position());
+    }
+    SUBCASE("expected_literal")
+    {
+        auto error = lexy::string_error<lexy::expected_literal>(input.begin() + 3, "dxf", 1);
+        auto compact = lexy::compact_error<decltype(input)>(context, error);
+        CHECK(compact.offset() == 3);
+        CHECK(compact.length() == 0);
+        CHECK(compact.is<lexy::expected_literal>());
+
+        auto materialized = compact.materialize_error<lexy::expected_literal>(input);
+        CHECK(materialized.position() == error.position());
+        CHECK(materialized.string() == error.string());
+        CHECK(materialized.index() == 1);
+    }
+    SUBCASE("expected_keyword")
+    {
+        auto error = lexy::string_error<lexy::expected_keyword>(input.begin(), input.begin() + 3,
+                                                                "abx");
+        auto compact = lexy::compact_error<decltype(input)>(context, error);
+        CHECK(compact.offset() == 0);
+        CHECK(compact.length() == 3);
+
+        auto materialized = compact.materialize_error<lexy::expected_keyword>(input);
+        CHECK(materialized.begin() == error.begin());
+        CHECK(materialized.end() == error.end());
+        CHECK(materialized.string() == error.string());
+    }
+    SUBCASE("expected_char_class")
+    {
+        auto error   = lexy::string_error<lexy::expected_char_class>(input.begin() + 5, "digit");
+        auto compact = lexy::compact_error<decltype(input)>(context, error);
+        CHECK(compact.offset() == 5);
+
+        auto materialized = compact.materialize_error<lexy::expected_char_class>(input);
+        CHECK(materialized.position() == error.position());
+        CHECK(materialized.character_class() == lexy::_detail::string_view("digit"));
+    }
+}
+
@@ -0,0 +1,99 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/huge_page_resource.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <doctest/doctest.h>
+#include <lexy/dsl/literal.hpp>
+#include <lexy/dsl/sequence.hpp>
+#include <lexy/input/buffer.hpp>
+#include <lexy/parse_tree.hpp>
+
+namespace
+{
+constexpr auto region_size = lexy::_detail::huge_page_size;
+
+bool is_aligned(void* ptr, std::size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+struct production
+{
+    static constexpr auto rule = LEXY_LIT("ab") + LEXY_LIT("ab");
+};
+} // namespace
+
+TEST_CASE("huge_page_resource")
+{
+    lexy::huge_page_resource resource(region_size);
+    CHECK(resource.mapped_bytes() == 0);
+    CHECK(resource.huge_page_bytes() == 0);
+
+    SUBCASE("small allocations")
+    {
+        auto a = resource.allocate(3, 1);
+        auto b = resource.allocate(16, 8);
+        auto c = resource.allocate(4096, 4096);
+        CHECK(is_aligned(b, 8));
+        CHECK(is_aligned(c, 4096));
+        CHECK(static_cast<unsigned char*>(b) >= static_cast<unsigned char*>(a) + 3);
+        CHECK(static_cast<unsigned char*>(c) >= static_cast<unsigned char*>(b) + 16);
+        CHECK(resource.mapped_bytes() == region_size);
+        CHECK(resource.huge_page_bytes() <= resource.mapped_bytes());
+
+        std::memset(c, 'c', 4096);
+        resource.deallocate(a, 3, 1);
+        resource.deallocate(b, 16, 8);
+        resource.deallocate(c, 4096, 4096);
+        CHECK(resource.mapped_bytes() == region_size);
+
+        // The next region is started once the current one is full.
+        for (auto i = 0; i != 8; ++i)
+            resource.allocate(region_size / 4, 8);
+        CHECK(resource.mapped_bytes() == 3 * region_size);
+
+        resource.release();
+        CHECK(resource.mapped_bytes() == 0);
+    }
+    SUBCASE("big allocations")
+    {
+        auto size = region_size + 1;
+        auto a    = resource.allocate(size, 64);
+        CHECK(is_aligned(a, 64));
+        CHECK(resource.mapped_bytes() == 2 * region_size);
+        std::memset(a, 'a', size);
+
+        auto b = resource.allocate(size, 64);
+        CHECK(resource.mapped_bytes() == 4 * region_size);
+
+        resource.deallocate(a, size, 64);
+        CHECK(resource.mapped_bytes() == 2 * region_size);
+        resource.deallocate(b, size, 64);
+        CHECK(resource.mapped_bytes() == 0);
+    }
+    SUBCASE("buffer")
+    {
+        lexy::buffer<lexy::default_encoding, lexy::huge_page_resource> buffer("abab", 4,
+                                                                              &resource);
+        CHECK(buffer.size() == 4);
+        CHECK(std::memcmp(buffer.data(), "abab", 4) == 0);
+        CHECK(resource.mapped_bytes() == region_size);
+    }
+    SUBCASE("parse_tree")
+    {
+        using buffer_t = lexy::buffer<lexy::default_encoding, lexy::huge_page_resource>;
+        buffer_t input("abab", 4, &resource);
+
+        lexy::parse_tree_for<buffer_t, void, lexy::huge_page_resource> tree(&resource);
+        CHECK(lexy::parse_as_tree<production>(tree, input, lexy::noop));
+        CHECK(tree.root().children().size() == 2);
+
+        lexy::compact_parse_tree_for<buffer_t, void, lexy::huge_page_resource> compact(&resource);
+        CHECK(lexy::parse_as_tree<production>(compact, input, lexy::noop));
+        CHECK(compact.root().children().size() == 2);
+    }
+}
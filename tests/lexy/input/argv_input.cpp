@@ -186,3 +186,41 @@ TEST_CASE("argv_input")
     CHECK(reader.eof());
 }
 
+TEST_CASE("argv_input range")
+{
+    char program[] = "IGNORED";
+    char first[]   = "abc";
+    char second[]  = "de";
+
+    char* argv[] = {program, first, second, nullptr};
+    int   argc   = 3;
+
+    SUBCASE("empty")
+    {
+        lexy::argv_input input(1, argv);
+        auto             reader = input.reader();
+        CHECK(reader.eof());
+        CHECK(reader.peek() == lexy::default_encoding::eof());
+        CHECK(reader.cur() == lexy::argv_end(1, argv));
+    }
+    SUBCASE("ends inside an argument")
+    {
+        auto end = lexy::argv_begin(argc, argv);
+        for (auto i = 0; i != 5; ++i)
+            ++end;
+        REQUIRE(*end == 'e');
+
+        lexy::argv_input<> input(lexy::argv_begin(argc, argv), end);
+        auto               reader = input.reader();
+        for (auto c : {'a', 'b', 'c', '\0', 'd'})
+        {
+            CHECK(!reader.eof());
+            CHECK(reader.peek() == c);
+            reader.bump();
+        }
+        CHECK(reader.eof());
+        CHECK(reader.peek() == lexy::default_encoding::eof());
+        CHECK(reader.cur() == end);
+    }
+}
+
@@ -0,0 +1,94 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/input/instrumented_input.hpp>
+
+#include <doctest/doctest.h>
+#include <lexy/dsl/choice.hpp>
+#include <lexy/dsl/eof.hpp>
+#include <lexy/dsl/literal.hpp>
+#include <lexy/dsl/sequence.hpp>
+#include <lexy/input/string_input.hpp>
+#include <lexy/match.hpp>
+
+namespace
+{
+struct production
+{
+    static constexpr auto rule = (LEXY_LIT("abd") | LEXY_LIT("abc")) + lexy::dsl::eof;
+};
+} // namespace
+
+TEST_CASE("instrumented_input")
+{
+    // It only references the input, so it can't be created from a temporary.
+    static_assert(std::is_constructible_v<lexy::instrumented_input<lexy::string_input<>>,
+                                          const lexy::string_input<>&>);
+    static_assert(!std::is_constructible_v<lexy::instrumented_input<lexy::string_input<>>,
+                                           lexy::string_input<>>);
+
+    auto string = lexy::zstring_input("abc");
+    auto input  = lexy::instrumented_input(string);
+    CHECK(input.statistics().peeks() == 0);
+    CHECK(input.statistics().positions() == 0);
+
+    SUBCASE("reader")
+    {
+        auto reader = input.reader();
+        CHECK(reader.cur() == string.reader().cur());
+        CHECK(reader.peek() == 'a');
+        CHECK(!reader.eof());
+
+        auto copy = reader;
+        reader.bump();
+        CHECK(reader.peek() == 'b');
+        reader.bump();
+        reader.bump();
+        CHECK(reader.eof());
+
+        reader = copy;
+        CHECK(reader.peek() == 'a');
+
+        auto& stats = input.statistics();
+        CHECK(stats.peeks() == 5);
+        CHECK(stats.bumps() == 3);
+        CHECK(stats.copies() == 1);
+        CHECK(stats.restores() == 1);
+
+        CHECK(stats.positions() == 4);
+        CHECK(stats.multiplicity(0) == 3);
+        CHECK(stats.multiplicity(1) == 1);
+        CHECK(stats.multiplicity(2) == 0);
+        CHECK(stats.multiplicity(3) == 1);
+        CHECK(stats.multiplicity(4) == 0);
+        CHECK(stats.rescans() == 2);
+
+        auto histogram = stats.multiplicity_histogram(2);
+        REQUIRE(histogram.size() == 3);
+        CHECK(histogram[0] == 1);
+        CHECK(histogram[1] == 2);
+        CHECK(histogram[2] == 1);
+
+        auto regions = stats.region_multiplicity(3);
+        REQUIRE(regions.size() == 2);
+        CHECK(regions[0] == 4);
+        CHECK(regions[1] == 1);
+
+        input.reset_statistics();
+        CHECK(input.statistics().peeks() == 0);
+        CHECK(input.statistics().positions() == 0);
+    }
+    SUBCASE("parsing")
+    {
+        CHECK(lexy::match<production>(input));
+
+        // The second alternative has to examine the input again.
+        auto& stats = input.statistics();
+        CHECK(stats.positions() == 4);
+        CHECK(stats.multiplicity(0) >= 2);
+        CHECK(stats.multiplicity(1) >= 2);
+        CHECK(stats.rescans() >= 2);
+        CHECK(stats.copies() >= 1);
+    }
+}
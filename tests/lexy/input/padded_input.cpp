@@ -0,0 +1,60 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/input/padded_input.hpp>
+
+#include <doctest/doctest.h>
+#include <string>
+
+TEST_CASE("padded_input")
+{
+    std::string str = "abc!";
+
+    SUBCASE("no sentinel")
+    {
+        auto input = lexy::padded_input(str.data(), 3, str.size());
+        CHECK(std::is_same_v<decltype(input), lexy::padded_input<lexy::default_encoding>>);
+        CHECK(input.begin() == str.data());
+        CHECK(input.end() == str.data() + 3);
+        CHECK(str[3] == '!');
+
+        auto reader = input.reader();
+        for (auto c : {'a', 'b', 'c'})
+        {
+            CHECK(!reader.eof());
+            CHECK(reader.peek() == c);
+            reader.bump();
+        }
+        CHECK(reader.cur() == input.end());
+        CHECK(reader.peek() == lexy::default_encoding::eof());
+        CHECK(reader.eof());
+    }
+    SUBCASE("sentinel")
+    {
+        auto input = lexy::padded_input<lexy::ascii_encoding>(str.data(), 3, str.size());
+        CHECK(input.begin() == str.data());
+        CHECK(input.end() == str.data() + 3);
+        CHECK(str[3] == lexy::ascii_encoding::eof());
+
+        auto reader = input.reader();
+        CHECK(std::is_same_v<decltype(reader),
+                             lexy::_detail::sentinel_reader<lexy::ascii_encoding>>);
+        for (auto c : {'a', 'b', 'c'})
+        {
+            CHECK(!reader.eof());
+            CHECK(reader.peek() == c);
+            reader.bump();
+        }
+        CHECK(reader.cur() == input.end());
+        CHECK(reader.peek() == lexy::ascii_encoding::eof());
+        CHECK(reader.eof());
+    }
+    SUBCASE("secondary char type")
+    {
+        auto input = lexy::padded_input<lexy::utf8_encoding>(str.data(), 0, str.size());
+        CHECK(str[0] == char(lexy::utf8_encoding::eof()));
+        CHECK(input.begin() == input.end());
+        CHECK(input.reader().eof());
+    }
+}
@@ -0,0 +1,91 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/input/segmented_input.hpp>
+
+#include <doctest/doctest.h>
+#include <string>
+#include <vector>
+
+TEST_CASE("segmented_input")
+{
+    SUBCASE("no segments")
+    {
+        lexy::segmented_input<> input;
+        CHECK(input.begin() == input.end());
+
+        auto reader = input.reader();
+        CHECK(reader.eof());
+        CHECK(reader.peek() == lexy::default_encoding::eof());
+        CHECK(reader.cur() == input.end());
+    }
+    SUBCASE("only empty segments")
+    {
+        std::vector<lexy::input_segment<char>> segments{{"", 0}, {"", 0}};
+        auto                                   input = lexy::segmented_input<>(segments);
+        CHECK(input.begin() == input.end());
+        CHECK(input.reader().eof());
+    }
+    SUBCASE("multiple segments")
+    {
+        std::vector<lexy::input_segment<char>> segments{{"", 0},
+                                                        {"ab", 2},
+                                                        {"", 0},
+                                                        {"c", 1},
+                                                        {"de", 2},
+                                                        {"", 0}};
+        auto input = lexy::segmented_input(segments.data(), segments.size());
+
+        auto reader = input.reader();
+        CHECK(reader.cur() == input.begin());
+        for (auto c : {'a', 'b', 'c', 'd', 'e'})
+        {
+            CHECK(!reader.eof());
+            CHECK(reader.peek() == c);
+            CHECK(*reader.cur() == c);
+            reader.bump();
+        }
+        CHECK(reader.eof());
+        CHECK(reader.peek() == lexy::default_encoding::eof());
+        CHECK(reader.cur() == input.end());
+
+        SUBCASE("iterator")
+        {
+            auto begin = input.begin();
+            auto end   = input.end();
+            CHECK(end - begin == 5);
+
+            std::string str;
+            for (auto cur = begin; cur != end; ++cur)
+                str.push_back(*cur);
+            CHECK(str == "abcde");
+
+            str.clear();
+            for (auto cur = end; cur != begin;)
+                str.push_back(*--cur);
+            CHECK(str == "edcba");
+        }
+        SUBCASE("lexeme")
+        {
+            auto begin = input.begin();
+            auto mid   = begin;
+            ++mid;
+            ++mid;
+            CHECK(*mid == 'c');
+
+            std::string buffer;
+
+            auto first = lexy::segmented_lexeme<>(begin, mid);
+            CHECK(first.size() == 2);
+            CHECK(lexy::segmented_lexeme_data(first, buffer) == segments[1].data);
+            CHECK(buffer.empty());
+
+            auto all = lexy::segmented_lexeme<>(begin, input.end());
+            CHECK(all.size() == 5);
+            auto data = lexy::segmented_lexeme_data(all, buffer);
+            CHECK(data == buffer.data());
+            CHECK(buffer == "abcde");
+        }
+    }
+}
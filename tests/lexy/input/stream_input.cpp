@@ -0,0 +1,124 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/input/stream_input.hpp>
+
+#include <algorithm>
+#include <doctest/doctest.h>
+#include <lexy/dsl.hpp>
+#include <lexy/validate.hpp>
+#include <string>
+
+namespace
+{
+// Returns the string in chunks of at most `chunk_size` characters.
+struct test_source
+{
+    const std::string* str;
+    std::size_t        chunk_size;
+    std::size_t        pos = 0;
+
+    std::size_t operator()(char* buffer, std::size_t size)
+    {
+        REQUIRE(size > 0);
+
+        auto count = std::min({size, chunk_size, str->size() - pos});
+        str->copy(buffer, count, pos);
+        pos += count;
+        return count;
+    }
+};
+
+namespace dsl = lexy::dsl;
+
+struct record
+{
+    static constexpr auto rule = dsl::until(dsl::newline);
+};
+
+struct committed_records
+{
+    static constexpr auto rule = dsl::terminator(dsl::eof).opt_list(dsl::p<record> + dsl::commit);
+};
+
+struct records
+{
+    static constexpr auto rule = dsl::terminator(dsl::eof).opt_list(dsl::p<record>);
+};
+} // namespace
+
+TEST_CASE("stream_input")
+{
+    SUBCASE("empty")
+    {
+        std::string str;
+        auto        input = lexy::stream_input(test_source{&str, 8});
+
+        auto reader = input.reader();
+        CHECK(reader.eof());
+        CHECK(reader.peek() == lexy::default_encoding::eof());
+        CHECK(reader.eof());
+    }
+    SUBCASE("chunks")
+    {
+        std::string str   = "abcdefg";
+        auto        input = lexy::stream_input(test_source{&str, 3});
+
+        auto reader = input.reader();
+        auto begin  = reader.cur();
+        for (auto c : str)
+        {
+            CHECK(!reader.eof());
+            CHECK(reader.peek() == c);
+            CHECK(*reader.cur() == c);
+            reader.bump();
+        }
+        CHECK(reader.eof());
+        CHECK(reader.peek() == lexy::default_encoding::eof());
+
+        auto end = reader.cur();
+        CHECK(end - begin == 7);
+        CHECK(end.position() == 7);
+
+        std::string result;
+        for (auto cur = begin; cur != end; ++cur)
+            result += *cur;
+        CHECK(result == str);
+    }
+
+    std::string str;
+    for (auto i = 0; i != 10 * 1000; ++i)
+        str += "record " + std::to_string(i) + "\n";
+
+    SUBCASE("committed")
+    {
+        auto input            = lexy::stream_input(test_source{&str, 100});
+        auto initial_capacity = input.window_capacity();
+
+        auto result = lexy::validate<committed_records>(input, lexy::noop);
+        CHECK(result);
+        CHECK(input.window_capacity() == initial_capacity);
+    }
+    SUBCASE("not committed")
+    {
+        auto input = lexy::stream_input(test_source{&str, 100});
+
+        auto result = lexy::validate<records>(input, lexy::noop);
+        CHECK(result);
+        CHECK(input.window_capacity() >= str.size());
+    }
+    SUBCASE("error")
+    {
+        str += "incomplete";
+
+        auto input  = lexy::stream_input(test_source{&str, 100});
+        auto offset = std::size_t(0);
+        auto result = lexy::validate<committed_records>(
+            input, lexy::callback([&](const auto&, const auto& error) {
+                offset = error.position().position();
+            }));
+        CHECK(!result);
+        CHECK(offset == str.size());
+    }
+}
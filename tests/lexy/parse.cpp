@@ -169,3 +169,25 @@ TEST_CASE("parse")
     }
 }
 
+namespace parse_extern
+{
+// Usually in a header, which doesn't need the grammar.
+LEXY_DECLARE_PARSER(parse_string_pair, parse_value::string_pair, lexy::string_input<>,
+                    decltype(lexy::noop));
+} // namespace parse_extern
+
+TEST_CASE("LEXY_DEFINE_PARSER")
+{
+    auto empty = parse_extern::parse_string_pair(lexy::zstring_input(""), lexy::noop);
+    CHECK(!empty);
+
+    auto abc_123 = parse_extern::parse_string_pair(lexy::zstring_input("(abc,123)"), lexy::noop);
+    CHECK(abc_123);
+    CHECK(abc_123.value().a == "abc");
+    CHECK(abc_123.value().b == "123");
+}
+
+// Usually in a separate source file, which is the only one that instantiates the grammar.
+LEXY_DEFINE_PARSER(parse_extern::parse_string_pair, parse_value::prod, parse_value::string_pair,
+                   lexy::string_input<>, decltype(lexy::noop))
+
@@ -0,0 +1,163 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/parse_budget.hpp>
+
+#include <doctest/doctest.h>
+#include <lexy/dsl/choice.hpp>
+#include <lexy/dsl/if.hpp>
+#include <lexy/dsl/list.hpp>
+#include <lexy/dsl/literal.hpp>
+#include <lexy/dsl/loop.hpp>
+#include <lexy/dsl/production.hpp>
+#include <lexy/dsl/recover.hpp>
+#include <lexy/dsl/sequence.hpp>
+#include <lexy/input/string_input.hpp>
+#include <vector>
+
+namespace
+{
+struct nested
+{
+    static constexpr auto rule
+        = lexy::dsl::if_(LEXY_LIT("(") >> lexy::dsl::recurse<nested> + LEXY_LIT(")"));
+};
+
+struct item
+{
+    static constexpr auto rule  = LEXY_LIT("abc");
+    static constexpr auto value = lexy::noop;
+};
+struct items
+{
+    static constexpr auto rule = lexy::dsl::list(lexy::dsl::p<item>);
+    static constexpr auto value = lexy::noop >> lexy::callback<int>([] { return 0; });
+};
+
+struct looped
+{
+    static constexpr auto rule = lexy::dsl::loop(LEXY_LIT("abc") | lexy::dsl::break_);
+};
+
+struct backtracking
+{
+    static constexpr auto rule
+        = lexy::dsl::loop(LEXY_LIT("abd") | LEXY_LIT("abc") | lexy::dsl::break_);
+};
+
+struct recovering
+{
+    static constexpr auto rule = lexy::dsl::try_(lexy::dsl::p<nested>) + LEXY_LIT("!");
+};
+
+struct stateful
+{
+    static constexpr auto rule  = LEXY_LIT("abc") + lexy::dsl::parse_state;
+    static constexpr auto value = lexy::forward<int>;
+};
+
+constexpr auto budget_kind_of = lexy::callback<int>(
+    [](auto, lexy::string_error<lexy::budget_exceeded> e) { return static_cast<int>(e.kind()); },
+    [](auto, auto) { return -1; });
+constexpr auto budget_errors = lexy::collect<std::vector<int>>(budget_kind_of);
+
+template <typename Production>
+int validate(const char* str, const lexy::parse_budget& budget)
+{
+    auto result
+        = lexy::validate_with_budget<Production>(lexy::zstring_input(str), budget, budget_errors);
+    if (result.is_success())
+        return -2;
+
+    REQUIRE(result.error_count() == 1);
+    return result.errors()[0];
+}
+} // namespace
+
+TEST_CASE("validate_with_budget")
+{
+    SUBCASE("unlimited")
+    {
+        CHECK(validate<nested>("((((()))))", {}) == -2);
+        CHECK(validate<items>("abcabcabc", {}) == -2);
+    }
+    SUBCASE("max_depth")
+    {
+        lexy::parse_budget budget;
+        budget.max_depth = 4;
+
+        CHECK(validate<nested>("((()))", budget) == -2);
+        CHECK(validate<nested>("(((())))", budget) == static_cast<int>(lexy::budget_kind::depth));
+    }
+    SUBCASE("max_token_units")
+    {
+        lexy::parse_budget budget;
+        budget.max_token_units = 6;
+
+        CHECK(validate<items>("abcabc", budget) == -2);
+        CHECK(validate<items>("abcabcabc", budget)
+              == static_cast<int>(lexy::budget_kind::token_units));
+
+        CHECK(validate<looped>("abcabc", budget) == -2);
+        CHECK(validate<looped>("abcabcabc", budget)
+              == static_cast<int>(lexy::budget_kind::token_units));
+
+        // Only accepted tokens count, not the failed attempts to match "abd".
+        CHECK(validate<backtracking>("abcabc", budget) == -2);
+        CHECK(validate<backtracking>("abcabcabc", budget)
+              == static_cast<int>(lexy::budget_kind::token_units));
+    }
+    SUBCASE("recovery")
+    {
+        lexy::parse_budget budget;
+        budget.max_depth = 4;
+
+        CHECK(validate<recovering>("(())!", budget) == -2);
+        // Without a budget, try_() would recover and then fail on the `!`.
+        CHECK(validate<recovering>("(((())))!", budget)
+              == static_cast<int>(lexy::budget_kind::depth));
+    }
+    SUBCASE("cancel")
+    {
+        std::atomic<bool>  cancel(false);
+        lexy::parse_budget budget;
+        budget.cancel = &cancel;
+
+        CHECK(validate<nested>("((()))", budget) == -2);
+        cancel = true;
+        CHECK(validate<nested>("((()))", budget) == static_cast<int>(lexy::budget_kind::cancel));
+    }
+    SUBCASE("deadline")
+    {
+        lexy::parse_budget budget;
+        budget.deadline          = std::chrono::steady_clock::now() + std::chrono::hours(1);
+        budget.deadline_interval = 0;
+        CHECK(validate<nested>("((()))", budget) == -2);
+
+        budget.deadline = std::chrono::steady_clock::now() - std::chrono::seconds(1);
+        CHECK(validate<nested>("((()))", budget) == static_cast<int>(lexy::budget_kind::deadline));
+    }
+}
+
+TEST_CASE("parse_with_budget")
+{
+    lexy::parse_budget budget;
+    budget.max_token_units = 3;
+
+    auto success = lexy::parse_with_budget<items>(lexy::zstring_input("abc"), budget,
+                                                  budget_errors);
+    CHECK(success);
+    CHECK(success.value() == 0);
+
+    auto failure = lexy::parse_with_budget<items>(lexy::zstring_input("abcabc"), budget,
+                                                  budget_errors);
+    CHECK(!failure);
+    CHECK(failure.error_count() == 1);
+    CHECK(failure.errors()[0] == static_cast<int>(lexy::budget_kind::token_units));
+
+    auto stateful_result
+        = lexy::parse_with_budget<stateful>(lexy::zstring_input("abc"), 42, budget, budget_errors);
+    CHECK(stateful_result);
+    CHECK(stateful_result.value() == 42);
+}
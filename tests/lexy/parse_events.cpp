@@ -0,0 +1,160 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/parse_events.hpp>
+
+#include <doctest/doctest.h>
+#include <lexy/dsl/ascii.hpp>
+#include <lexy/dsl/brackets.hpp>
+#include <lexy/dsl/capture.hpp>
+#include <lexy/dsl/digit.hpp>
+#include <lexy/dsl/list.hpp>
+#include <lexy/dsl/literal.hpp>
+#include <lexy/dsl/production.hpp>
+#include <lexy/dsl/punctuator.hpp>
+#include <lexy/dsl/sequence.hpp>
+#include <lexy/input/string_input.hpp>
+#include <string>
+
+namespace
+{
+namespace dsl = lexy::dsl;
+
+struct item_p;
+
+struct number_p : lexy::token_production
+{
+    static constexpr auto rule = dsl::digits<>;
+};
+
+struct list_p
+{
+    static constexpr auto rule = dsl::square_bracketed.opt_list(dsl::recurse<item_p>,
+                                                                dsl::sep(dsl::comma));
+};
+
+struct item_p
+{
+    static constexpr auto rule = dsl::p<list_p> | dsl::p<number_p>;
+};
+
+struct root_p
+{
+    static constexpr auto whitespace = dsl::ascii::space;
+    static constexpr auto rule       = dsl::p<item_p> + dsl::eof;
+};
+
+struct visitor
+{
+    std::string events;
+
+    void start(list_p)
+    {
+        events += "[";
+    }
+    void start(number_p)
+    {
+        events += "<";
+    }
+
+    template <typename Lexeme>
+    void finish(list_p, Lexeme lexeme)
+    {
+        events += "](" + std::string(lexeme.begin(), lexeme.end()) + ")";
+    }
+    template <typename Lexeme>
+    void finish(number_p, Lexeme lexeme)
+    {
+        events += std::string(lexeme.begin(), lexeme.end()) + ">";
+    }
+};
+
+auto events(const char* str)
+{
+    visitor v;
+    auto    input  = lexy::zstring_input(str);
+    auto    result = lexy::parse_events<root_p>(input, v, lexy::noop);
+    return std::make_pair(static_cast<bool>(result), v.events);
+}
+} // namespace
+
+TEST_CASE("parse_events")
+{
+    SUBCASE("token")
+    {
+        auto [success, events] = ::events("123");
+        CHECK(success);
+        CHECK(events == "<123>");
+    }
+    SUBCASE("empty list")
+    {
+        auto [success, events] = ::events("[]");
+        CHECK(success);
+        CHECK(events == "[]([])");
+    }
+    SUBCASE("list")
+    {
+        // The number production is tried first in the list, but backtracks.
+        auto [success, events] = ::events("[1, [2], 34] ");
+        CHECK(success);
+        CHECK(events == "[<1>[<2>]([2])<34>]([1, [2], 34] )");
+    }
+    SUBCASE("error")
+    {
+        auto [success, events] = ::events("[1, x]");
+        CHECK(!success);
+        // The list recovers at the closing bracket.
+        CHECK(events == "[<1>]([1, x])");
+    }
+}
+
+TEST_CASE("parse_events handler")
+{
+    // Drives the handler directly, as the grammars above can't produce every order of events.
+    auto input = lexy::zstring_input("123");
+    auto begin = input.begin();
+
+    visitor v;
+    auto    handler = lexy::_event_handler(v, input, lexy::noop);
+
+    SUBCASE("backtrack after empty child")
+    {
+        auto root = handler.start_production(root_p{}, begin);
+
+        // The list finishes an empty number, then backtracks.
+        auto list   = handler.start_production(list_p{}, begin);
+        auto number = handler.start_production(number_p{}, begin);
+        handler.finish_production(number_p{}, LEXY_MOV(number));
+        CHECK(v.events.empty());
+        handler.backtrack_production(list_p{}, LEXY_MOV(list));
+        CHECK(v.events.empty());
+
+        number = handler.start_production(number_p{}, begin);
+        handler.token(lexy::unknown_token_kind, begin, begin + 3);
+        handler.finish_production(number_p{}, LEXY_MOV(number));
+        handler.finish_production(root_p{}, LEXY_MOV(root));
+        CHECK(v.events == "<123>");
+    }
+    SUBCASE("empty child of committed production")
+    {
+        auto root = handler.start_production(root_p{}, begin);
+
+        auto list = handler.start_production(list_p{}, begin);
+        handler.token(lexy::unknown_token_kind, begin, begin + 1);
+        CHECK(v.events == "[");
+
+        // The list can no longer backtrack, so the empty number is reported on finish.
+        auto number = handler.start_production(number_p{}, begin + 1);
+        auto inner  = handler.start_production(number_p{}, begin + 1);
+        handler.finish_production(number_p{}, LEXY_MOV(inner));
+        CHECK(v.events == "[");
+        handler.finish_production(number_p{}, LEXY_MOV(number));
+        CHECK(v.events == "[<<>>");
+
+        handler.finish_production(list_p{}, LEXY_MOV(list));
+        handler.finish_production(root_p{}, LEXY_MOV(root));
+        CHECK(v.events == "[<<>>](1)");
+    }
+}
+
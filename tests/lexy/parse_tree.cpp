@@ -757,3 +757,175 @@ TEST_CASE("parse_as_tree")
     }
 }
 
+TEST_CASE("parse_as_tree with compact layout")
+{
+    using parse_tree = lexy::compact_parse_tree_for<lexy::string_input<>, token_kind>;
+    parse_tree tree;
+
+    SUBCASE("fits_compact_parse_tree")
+    {
+        CHECK(lexy::fits_compact_parse_tree(lexy::zstring_input("123(abc)321")));
+    }
+    SUBCASE("parenthesized")
+    {
+        auto input  = lexy::zstring_input("123(abc)321");
+        auto result = lexy::parse_as_tree<root_p>(tree, input, lexy::noop);
+        CHECK(result);
+
+        // clang-format off
+        auto expected = lexy_ext::parse_tree_desc<token_kind>(root_p{})
+            .token(token_kind::a, "123")
+            .production(child_p{})
+                .token(token_kind::b, "(")
+                .token(token_kind::c, "abc")
+                .token(token_kind::b, ")")
+                .finish()
+            .token(token_kind::a, "321");
+        // clang-format on
+        CHECK(tree == expected);
+        CHECK(tree.root().children().begin()->lexeme().begin() == input.begin());
+    }
+    SUBCASE("quoted")
+    {
+        auto input  = lexy::zstring_input("123\"abc\"321");
+        auto result = lexy::parse_as_tree<root_p>(tree, input, lexy::noop);
+        CHECK(result);
+
+        // clang-format off
+        auto expected = lexy_ext::parse_tree_desc<token_kind>(root_p{})
+            .token(token_kind::a, "123")
+            .production(child_p{})
+                .production(string_p{})
+                    .token(token_kind::b, "\"")
+                    .token(token_kind::c, "abc")
+                    .token(token_kind::b, "\"")
+                    .finish()
+                .finish()
+            .token(token_kind::a, "321");
+        // clang-format on
+        CHECK(tree == expected);
+    }
+    SUBCASE("many blocks")
+    {
+        // Enough nodes that links have to cross blocks.
+        auto input = lexy::zstring_input("abc");
+        auto build = [&](auto tree) {
+            using tree_t = decltype(tree);
+            typename tree_t::builder builder(LEXY_MOV(tree), root_p{}, input.begin());
+
+            std::vector<typename tree_t::builder::production_state> states;
+            for (auto i = 0; i != 1000; ++i)
+            {
+                states.push_back(builder.start_production(child_p{}));
+                builder.token(token_kind::a, input.begin(), input.begin() + i % 3);
+                builder.token(token_kind::b, input.begin() + i % 3, input.begin() + 3);
+            }
+            while (!states.empty())
+            {
+                builder.finish_production(LEXY_MOV(states.back()));
+                states.pop_back();
+            }
+
+            return LEXY_MOV(builder).finish();
+        };
+
+        auto pointer = build(lexy::parse_tree_for<lexy::string_input<>, token_kind>());
+        auto check   = [&](const parse_tree& compact) {
+            auto compact_range = compact.traverse();
+            auto pointer_range = pointer.traverse();
+            auto compact_iter  = compact_range.begin();
+            auto pointer_iter  = pointer_range.begin();
+            for (; compact_iter != compact_range.end() && pointer_iter != pointer_range.end();
+                 ++compact_iter, ++pointer_iter)
+            {
+                REQUIRE(compact_iter->event == pointer_iter->event);
+
+                auto compact_node = compact_iter->node;
+                auto pointer_node = pointer_iter->node;
+                REQUIRE(compact_node.kind().name() == pointer_node.kind().name());
+                REQUIRE(compact_node.lexeme().begin() == pointer_node.lexeme().begin());
+                REQUIRE(compact_node.lexeme().end() == pointer_node.lexeme().end());
+                REQUIRE(compact_node.parent().kind().name() == pointer_node.parent().kind().name());
+                REQUIRE(compact_node.is_last_child() == pointer_node.is_last_child());
+            }
+            CHECK(compact_iter == compact_range.end());
+            CHECK(pointer_iter == pointer_range.end());
+        };
+
+        auto compact = build(LEXY_MOV(tree));
+        check(compact);
+
+        // Rebuilding re-uses the blocks.
+        compact = build(LEXY_MOV(compact));
+        check(compact);
+    }
+}
+
+TEST_CASE("parse_as_tree with hashed layout")
+{
+    using parse_tree   = lexy::hashed_parse_tree_for<lexy::string_input<>, token_kind>;
+    using compact_tree = lexy::hashed_parse_tree_for<lexy::string_input<>, token_kind,
+                                                     lexy::_detail::default_memory_resource,
+                                                     lexy::parse_tree_compact_layout>;
+
+    auto parse = [](auto tree, const char* str) {
+        auto input  = lexy::zstring_input(str);
+        auto result = lexy::parse_as_tree<root_p>(tree, input, lexy::noop);
+        REQUIRE(result);
+        return tree;
+    };
+
+    // The trees are of different inputs with the same content.
+    auto tree = parse(parse_tree(), "123\"abc\"321");
+    auto same = parse(parse_tree(), "123\"abc\"321");
+    CHECK(tree.root().subtree_hash() == same.root().subtree_hash());
+    CHECK(parse(compact_tree(), "123\"abc\"321").root().subtree_hash()
+          == tree.root().subtree_hash());
+
+    // clang-format off
+    auto expected = lexy_ext::parse_tree_desc<token_kind>(root_p{})
+        .token(token_kind::a, "123")
+        .production(child_p{})
+            .production(string_p{})
+                .token(token_kind::b, "\"")
+                .token(token_kind::c, "abc")
+                .token(token_kind::b, "\"")
+                .finish()
+            .finish()
+        .token(token_kind::a, "321");
+    // clang-format on
+    CHECK(tree == expected);
+
+    auto first_child = [](const auto& t) { return *t.root().children().begin(); };
+    auto child       = [](const auto& t) { return *++t.root().children().begin(); };
+
+    SUBCASE("different token")
+    {
+        auto other = parse(parse_tree(), "123\"abd\"321");
+        CHECK(other.root().subtree_hash() != tree.root().subtree_hash());
+        CHECK(first_child(other).subtree_hash() == first_child(tree).subtree_hash());
+        CHECK(child(other).subtree_hash() != child(tree).subtree_hash());
+    }
+    SUBCASE("different structure")
+    {
+        // Same text, but the tokens are split differently.
+        auto other = parse(parse_tree(), "123(abc)321");
+        CHECK(other.root().subtree_hash() != tree.root().subtree_hash());
+        CHECK(first_child(other).subtree_hash() == first_child(tree).subtree_hash());
+        CHECK(child(other).subtree_hash() != child(tree).subtree_hash());
+    }
+    SUBCASE("token and production")
+    {
+        CHECK(first_child(tree).subtree_hash() != child(tree).subtree_hash());
+        CHECK(first_child(tree).subtree_hash()
+              != (*++++tree.root().children().begin()).subtree_hash());
+    }
+    SUBCASE("compact")
+    {
+        auto compact = parse(compact_tree(), "123\"abd\"321");
+        auto pointer = parse(parse_tree(), "123\"abd\"321");
+        CHECK(compact.root().subtree_hash() == pointer.root().subtree_hash());
+        CHECK(first_child(compact).subtree_hash() == first_child(tree).subtree_hash());
+    }
+}
+
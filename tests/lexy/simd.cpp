@@ -0,0 +1,167 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/simd.hpp>
+
+#include <cstdint>
+#include <doctest/doctest.h>
+#include <string>
+
+namespace
+{
+constexpr lexy::simd_level all_levels[] = {lexy::simd_level::scalar, lexy::simd_level::sse2,
+                                           lexy::simd_level::sse4_2, lexy::simd_level::avx2,
+                                           lexy::simd_level::avx512};
+
+// Deterministic bytes, mostly ASCII with a couple of newlines.
+std::string make_text(std::size_t size, std::uint32_t seed)
+{
+    std::string result;
+    for (auto i = std::size_t(0); i != size; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        auto value = (seed >> 16) % 64;
+        result.push_back(value == 0 ? '\n' : char('a' + value % 26));
+    }
+    return result;
+}
+
+std::size_t count_newlines_naive(const std::string& str)
+{
+    std::size_t result = 0;
+    for (auto c : str)
+        if (c == '\n')
+            ++result;
+    return result;
+}
+
+void check_find_non_ascii()
+{
+    for (auto size = std::size_t(0); size != 150; ++size)
+    {
+        auto text  = make_text(size, std::uint32_t(size));
+        auto begin = text.data();
+        auto end   = text.data() + text.size();
+        CHECK(lexy::find_non_ascii(begin, end) == end);
+
+        for (auto pos = std::size_t(0); pos < size; pos += 7)
+        {
+            auto copy = text;
+            copy[pos] = char(0x80 + pos % 0x80);
+            if (pos + 3 < size)
+                copy[pos + 3] = char(0xFF);
+
+            CHECK(lexy::find_non_ascii(copy.data(), copy.data() + size) == copy.data() + pos);
+        }
+    }
+}
+
+void check_find_invalid_utf8()
+{
+    auto check = [](const std::string& str, std::size_t expected) {
+        auto begin = str.data();
+        auto end   = str.data() + str.size();
+        CHECK(lexy::find_invalid_utf8(begin, end) - begin == std::ptrdiff_t(expected));
+    };
+
+    auto text = make_text(100, 42);
+    check(text, 100);
+
+    // Well-formed sequences of every length, including the boundaries of table 3-7.
+    check(text + "\xC2\x80\xDF\xBF" + text, 204);
+    check(text + "\xE0\xA0\x80\xED\x9F\xBF\xEF\xBF\xBF" + text, 209);
+    check(text + "\xF0\x90\x80\x80\xF4\x8F\xBF\xBF" + text, 208);
+
+    // Ill-formed sequences.
+    check(text + "\x80" + text, 100);
+    check(text + "\xC0\xAF" + text, 100);
+    check(text + "\xC2" + text, 100);
+    check(text + "\xE0\x80\x80" + text, 100);
+    check(text + "\xED\xA0\x80" + text, 100);
+    check(text + "\xF4\x90\x80\x80" + text, 100);
+    check(text + "\xF5\x80\x80\x80" + text, 100);
+    check(text + "\xC3\xA4\xF0\x90\x80", 102);
+    check("\xE2\x82", 0);
+}
+
+void check_count_newlines()
+{
+    for (auto size = std::size_t(0); size < 300; size += 13)
+    {
+        auto text = make_text(size, std::uint32_t(size) + 1);
+        for (auto offset = std::size_t(0); offset != 3 && offset <= size; ++offset)
+        {
+            auto begin = text.data() + offset;
+            auto end   = text.data() + size;
+            CHECK(lexy::count_newlines(begin, end)
+                  == count_newlines_naive(std::string(begin, end)));
+        }
+    }
+
+    auto all = std::string(1000, '\n');
+    CHECK(lexy::count_newlines(all.data(), all.data() + all.size()) == 1000);
+}
+
+void check_byte_swap()
+{
+    for (auto size = std::size_t(0); size != 70; ++size)
+    {
+        std::u16string utf16;
+        std::u32string utf32;
+        for (auto i = std::size_t(0); i != size; ++i)
+        {
+            utf16.push_back(char16_t(0x0102 + i));
+            utf32.push_back(char32_t(0x01020304 + i));
+        }
+
+        lexy::byte_swap(utf16.data(), utf16.size());
+        lexy::byte_swap(utf32.data(), utf32.size());
+        for (auto i = std::size_t(0); i != size; ++i)
+        {
+            auto c16 = std::uint_least16_t(0x0102 + i);
+            auto c32 = std::uint_least32_t(0x01020304 + i);
+            CHECK(utf16[i] == char16_t(((c16 & 0xFF) << 8) | (c16 >> 8)));
+            CHECK(utf32[i]
+                  == char32_t(((c32 & 0xFF) << 24) | ((c32 & 0xFF00) << 8) | ((c32 >> 8) & 0xFF00)
+                              | (c32 >> 24)));
+        }
+    }
+}
+} // namespace
+
+TEST_CASE("simd_level")
+{
+    auto supported = lexy::supported_simd_level();
+    CHECK(lexy::active_simd_level() <= supported);
+
+    CHECK(lexy::set_simd_level(lexy::simd_level::scalar) == lexy::simd_level::scalar);
+    CHECK(lexy::active_simd_level() == lexy::simd_level::scalar);
+
+    // Higher levels are clamped.
+    CHECK(lexy::set_simd_level(lexy::simd_level::avx512) <= supported);
+
+    lexy::set_simd_level(supported);
+    CHECK(lexy::active_simd_level() == supported);
+}
+
+TEST_CASE("simd kernels")
+{
+    // Forces each level the CPU supports, the others are clamped.
+    for (auto level : all_levels)
+    {
+        if (level > lexy::supported_simd_level())
+            continue;
+
+        CAPTURE(int(level));
+        REQUIRE(lexy::set_simd_level(level) == level);
+
+        check_find_non_ascii();
+        check_find_invalid_utf8();
+        check_count_newlines();
+        check_byte_swap();
+    }
+
+    lexy::set_simd_level(lexy::supported_simd_level());
+}
+
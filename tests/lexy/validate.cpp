@@ -131,5 +131,32 @@ TEST_CASE("validate")
         CHECK(!missing_paren);
         CHECK(missing_paren.errors() == std::vector{-3});
     }
+    SUBCASE("compact errors")
+    {
+        using input_t  = lexy::string_input<>;
+        using errors_t = std::vector<lexy::compact_error<input_t>>;
+        constexpr auto callback = lexy::collect_compact<errors_t>;
+
+        auto success = lexy::validate<prod_b>(lexy::zstring_input("(abc)"), callback);
+        CHECK(success);
+        CHECK(success.errors().empty());
+
+        auto input       = lexy::zstring_input("(adc)");
+        auto invalid_abc = lexy::validate<prod_b>(input, callback);
+        CHECK(!invalid_abc);
+        REQUIRE(invalid_abc.error_count() == 1);
+
+        auto error = invalid_abc.errors().front();
+        CHECK(error.offset() == 1);
+        CHECK(error.production_offset() == 1);
+        CHECK(error.is<lexy::expected_literal>());
+        CHECK(error.is_in<prod_a>());
+        CHECK(error.production() == lexy::_detail::string_view("prod_a"));
+
+        auto materialized = error.materialize_error<lexy::expected_literal>(input);
+        CHECK(*materialized.position() == 'a');
+        CHECK(materialized.string() == lexy::_detail::string_view("abc"));
+        CHECK(materialized.index() == 1);
+    }
 }
 
@@ -0,0 +1,75 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#define LEXY_CHOICE_STATISTICS 1
+#include <lexy_ext/choice_profile.hpp>
+
+#include <cstring>
+#include <doctest/doctest.h>
+#include <lexy/dsl/eof.hpp>
+#include <lexy/dsl/while.hpp>
+#include <lexy/input/string_input.hpp>
+#include <lexy/match.hpp>
+#include <string>
+
+namespace choice_profile_test
+{
+struct record_kind;
+
+struct production
+{
+    static constexpr auto rule
+        = lexy::dsl::while_(lexy::dsl::profiled_choice<record_kind>(
+              LEXY_LIT("a") | LEXY_LIT("b") | LEXY_LIT("c")))
+          + lexy::dsl::eof;
+};
+} // namespace choice_profile_test
+
+TEST_CASE("choice_statistics")
+{
+    lexy_ext::reset_choice_statistics();
+    CHECK(lexy::match<choice_profile_test::production>(lexy::zstring_input("acac")));
+
+    const lexy::choice_statistics* stats = nullptr;
+    for (auto cur = lexy::choice_statistics::first(); cur; cur = cur->next())
+        if (std::strcmp(cur->tag_name(), "choice_profile_test::record_kind") == 0)
+            stats = cur;
+    REQUIRE(stats);
+
+    REQUIRE(stats->alternatives() == 3);
+    CHECK(stats->hits(0) == 2);
+    CHECK(stats->hits(1) == 0);
+    CHECK(stats->hits(2) == 2);
+    // The alternatives before the one that is taken, and all of them at the end.
+    CHECK(stats->misses(0) == 3);
+    CHECK(stats->misses(1) == 3);
+    CHECK(stats->misses(2) == 1);
+
+    SUBCASE("write_choice_profile")
+    {
+        auto file = std::tmpfile();
+        REQUIRE(file);
+        lexy_ext::write_choice_profile(file);
+
+        std::string output;
+        std::rewind(file);
+        for (auto c = std::fgetc(file); c != EOF; c = std::fgetc(file))
+            output += static_cast<char>(c);
+        std::fclose(file);
+
+        auto expected = "\ntemplate <>\n"
+                        "struct lexy::choice_profile<choice_profile_test::record_kind>\n"
+                        "{\n"
+                        "    // misses: 3, 3, 1\n"
+                        "    static constexpr std::uint64_t hits[] = {2, 0, 2};\n"
+                        "};\n";
+        CHECK(output.find(expected) != std::string::npos);
+    }
+    SUBCASE("reset")
+    {
+        lexy_ext::reset_choice_statistics();
+        CHECK(stats->hits(0) == 0);
+        CHECK(stats->misses(0) == 0);
+    }
+}
@@ -0,0 +1,228 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy_ext/parse_cache.hpp>
+
+#include <doctest/doctest.h>
+#include <lexy/callback.hpp>
+#include <lexy/dsl/capture.hpp>
+#include <lexy/dsl/eof.hpp>
+#include <lexy/dsl/list.hpp>
+#include <lexy/dsl/literal.hpp>
+#include <lexy/dsl/sequence.hpp>
+#include <lexy/input/buffer.hpp>
+#include <lexy/input/string_input.hpp>
+
+namespace
+{
+int parse_count = 0;
+
+struct production
+{
+    static constexpr auto rule = list(capture(LEXY_LIT("abc"))) + lexy::dsl::eof;
+    static constexpr auto value
+        = lexy::collect(lexy::noop) >> lexy::callback<std::size_t>([](std::size_t count) {
+              ++parse_count;
+              return count;
+          });
+};
+
+struct codec
+{
+    using value_type = std::size_t;
+
+    void save(std::size_t value, std::string& out) const
+    {
+        out += std::to_string(value);
+    }
+
+    std::optional<std::size_t> load(const unsigned char* data, std::size_t size) const
+    {
+        auto str = std::string(reinterpret_cast<const char*>(data), size);
+        if (str.empty() || str == "invalid")
+            return std::nullopt;
+        return std::stoul(str);
+    }
+};
+
+const auto directory = std::filesystem::path("lexy-parse-cache.test.delete-me");
+} // namespace
+
+TEST_CASE("hash_bytes")
+{
+    auto hash = [](const char* str, std::uint64_t seed = 0) {
+        return lexy_ext::hash_bytes(str, std::strlen(str), seed);
+    };
+
+    CHECK(hash("") != hash("a"));
+    CHECK(hash("abc") == hash("abc"));
+    CHECK(hash("abc") != hash("abd"));
+    CHECK(hash("abc") != hash("abc", 1));
+    CHECK(hash("0123456789abcdef") != hash("0123456789abcdeg"));
+    CHECK(hash("abcdefgh") != hash("abcdefgh\0", 1));
+}
+
+TEST_CASE("cached_parse")
+{
+    std::filesystem::remove_all(directory);
+
+    auto parse = [](lexy_ext::parse_cache& cache, const char* str) {
+        auto input = lexy::string_input(str, std::strlen(str));
+        return lexy_ext::cached_parse<production>(cache, input, codec{}, lexy::noop);
+    };
+
+    for (auto background : {false, true})
+    {
+        lexy_ext::parse_cache_options options;
+        options.background_store = background;
+
+        parse_count = 0;
+        {
+            lexy_ext::parse_cache cache(directory, options);
+
+            auto cold = parse(cache, "abcabc");
+            CHECK(cold);
+            CHECK(!cold.is_cached());
+            CHECK(cold.value() == 2);
+            CHECK(cold.result().is_success());
+            CHECK(parse_count == 1);
+
+            cache.flush();
+            auto warm = parse(cache, "abcabc");
+            CHECK(warm);
+            CHECK(warm.is_cached());
+            CHECK(warm.value() == 2);
+            CHECK(parse_count == 1);
+
+            auto other = parse(cache, "abc");
+            CHECK(!other.is_cached());
+            CHECK(other.value() == 1);
+            CHECK(parse_count == 2);
+
+            // Errors aren't cached.
+            auto error = parse(cache, "abd");
+            CHECK(!error);
+            CHECK(!error.is_cached());
+            cache.flush();
+            CHECK(!parse(cache, "abd").is_cached());
+        }
+
+        // The cache persists.
+        {
+            lexy_ext::parse_cache cache(directory, options);
+            CHECK(parse(cache, "abcabc").is_cached());
+            CHECK(parse(cache, "abc").is_cached());
+        }
+
+        // A different version has different keys.
+        {
+            options.version = "2";
+            lexy_ext::parse_cache cache(directory, options);
+            CHECK(!parse(cache, "abcabc").is_cached());
+        }
+
+        std::filesystem::remove_all(directory);
+    }
+}
+
+TEST_CASE("cached_parse with buffer")
+{
+    std::filesystem::remove_all(directory);
+
+    parse_count = 0;
+    {
+        lexy_ext::parse_cache_options options;
+        options.background_store = false;
+        lexy_ext::parse_cache cache(directory, options);
+
+        auto parse = [&](const char* str) {
+            auto input = lexy::buffer<lexy::utf8_encoding>(str, std::strlen(str));
+            return lexy_ext::cached_parse<production>(cache, input, codec{}, lexy::noop);
+        };
+
+        auto cold = parse("abcabcabc");
+        CHECK(!cold.is_cached());
+        CHECK(cold.value() == 3);
+
+        auto warm = parse("abcabcabc");
+        CHECK(warm.is_cached());
+        CHECK(warm.value() == 3);
+        CHECK(parse_count == 1);
+
+        // The key only depends on the bytes, not the input type.
+        auto input = lexy::string_input<lexy::utf8_encoding>("abcabcabc", 9);
+        CHECK(lexy_ext::cached_parse<production>(cache, input, codec{}, lexy::noop).is_cached());
+    }
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("parse_cache background store")
+{
+    std::filesystem::remove_all(directory);
+
+    {
+        lexy_ext::parse_cache cache(directory);
+        for (auto i = 0u; i != 100; ++i)
+            cache.store(i, 3, std::to_string(i));
+        cache.flush();
+
+        std::string result;
+        CHECK(cache.lookup(42, 3, [&](const unsigned char* data, std::size_t size) {
+            result.assign(reinterpret_cast<const char*>(data), size);
+        }));
+        CHECK(result == "42");
+
+        // The destructor writes the remaining entries.
+        cache.store(100, 3, "100");
+    }
+    {
+        lexy_ext::parse_cache cache(directory);
+        CHECK(cache.lookup(100, 3, [](const unsigned char*, std::size_t) {}));
+
+        // No temporary files are left behind.
+        for (auto& entry : std::filesystem::directory_iterator(directory))
+            CHECK(entry.path().extension() == ".lexy-cache");
+    }
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("parse_cache")
+{
+    std::filesystem::remove_all(directory);
+
+    lexy_ext::parse_cache_options options;
+    options.max_entries      = 2;
+    options.background_store = false;
+    lexy_ext::parse_cache cache(directory, options);
+
+    auto lookup = [&](std::uint64_t key, std::size_t size = 3) {
+        std::string result = "<none>";
+        cache.lookup(key, size, [&](const unsigned char* data, std::size_t size) {
+            result.assign(reinterpret_cast<const char*>(data), size);
+        });
+        return result;
+    };
+
+    cache.store(1, 3, "one");
+    cache.store(2, 3, "two");
+    CHECK(lookup(1) == "one");
+    CHECK(lookup(2) == "two");
+    CHECK(lookup(1, 4) == "<none>");
+    CHECK(lookup(3) == "<none>");
+
+    // Make 2 the least recently used entry.
+    auto old_time = std::filesystem::file_time_type::clock::now() - std::chrono::hours(1);
+    for (auto& entry : std::filesystem::directory_iterator(directory))
+        if (entry.path().stem() == "0000000000000002")
+            std::filesystem::last_write_time(entry.path(), old_time);
+
+    cache.store(3, 3, "three");
+    CHECK(lookup(1) == "one");
+    CHECK(lookup(2) == "<none>");
+    CHECK(lookup(3) == "three");
+
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,124 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy_ext/parse_metrics.hpp>
+
+#include <doctest/doctest.h>
+#include <lexy/dsl/eof.hpp>
+#include <lexy/dsl/list.hpp>
+#include <lexy/dsl/literal.hpp>
+#include <lexy/dsl/recover.hpp>
+#include <lexy/dsl/sequence.hpp>
+#include <lexy/input/string_input.hpp>
+#include <thread>
+
+namespace
+{
+struct items
+{
+    static constexpr auto name  = "items";
+    static constexpr auto rule  = list(LEXY_LIT("abc")) + lexy::dsl::eof;
+    static constexpr auto value = lexy::noop >> lexy::callback<int>([] { return 0; });
+};
+
+struct recovering
+{
+    static constexpr auto name = "recovering";
+    static constexpr auto rule = lexy::dsl::try_(LEXY_LIT("abc")) + LEXY_LIT("!");
+};
+
+constexpr auto errors = lexy::collect<std::vector<int>>(lexy::callback<int>([](auto, auto) {
+    return 0;
+}));
+} // namespace
+
+TEST_CASE("parse_metrics")
+{
+    lexy_ext::parse_metrics metrics;
+
+    SUBCASE("single thread")
+    {
+        auto validate = [&](auto production, const char* str) {
+            using production_t = decltype(production);
+            return lexy_ext::validate_with_metrics<production_t>(lexy::zstring_input(str), metrics,
+                                                                 errors);
+        };
+        CHECK(validate(items{}, "abcabc"));
+        CHECK(validate(items{}, "abc"));
+        CHECK(validate(items{}, "abd").is_fatal_error());
+        CHECK(validate(recovering{}, "!").is_recovered_error());
+
+        auto parsed
+            = lexy_ext::parse_with_metrics<items>(lexy::zstring_input("abc"), metrics, errors);
+        CHECK(parsed);
+        CHECK(parsed.value() == 0);
+
+        auto snapshot = metrics.snapshot();
+        REQUIRE(snapshot.productions.size() == 2);
+
+        auto& items_metrics = snapshot.productions[0];
+        CHECK(items_metrics.production == "items");
+        CHECK(items_metrics.parses == 4);
+        // The failed parse stopped after "ab".
+        CHECK(items_metrics.bytes == 6 + 3 + 2 + 3);
+        CHECK(items_metrics.successes == 3);
+        CHECK(items_metrics.recovered_errors == 0);
+        CHECK(items_metrics.fatal_errors == 1);
+
+        auto latency_count = std::uint64_t(0);
+        for (auto count : items_metrics.latency_buckets)
+            latency_count += count;
+        CHECK(latency_count == 4);
+
+        auto& recovering_metrics = snapshot.productions[1];
+        CHECK(recovering_metrics.production == "recovering");
+        CHECK(recovering_metrics.parses == 1);
+        CHECK(recovering_metrics.recovered_errors == 1);
+
+        REQUIRE(snapshot.errors.size() == 2);
+        CHECK(snapshot.errors[0].production == "items");
+        CHECK(snapshot.errors[0].tag == "expected_literal");
+        CHECK(snapshot.errors[0].count == 1);
+        CHECK(snapshot.errors[1].production == "recovering");
+        CHECK(snapshot.errors[1].count == 1);
+
+        auto text = lexy_ext::to_prometheus(snapshot);
+        CHECK(text.find("# TYPE lexy_parses_total counter\n") != std::string::npos);
+        CHECK(text.find("lexy_parses_total{production=\"items\"} 4\n") != std::string::npos);
+        CHECK(text.find("lexy_parse_bytes_total{production=\"items\"} 14\n") != std::string::npos);
+        CHECK(text.find("lexy_parse_results_total{production=\"items\",result=\"fatal_error\"} 1\n")
+              != std::string::npos);
+        CHECK(text.find("lexy_parse_errors_total{production=\"items\",tag=\"expected_literal\"} "
+                        "1\n")
+              != std::string::npos);
+        CHECK(text.find("lexy_parse_duration_seconds_bucket{production=\"items\",le=\"+Inf\"} 4\n")
+              != std::string::npos);
+        CHECK(text.find("lexy_parse_duration_seconds_count{production=\"items\"} 4\n")
+              != std::string::npos);
+    }
+    SUBCASE("multiple threads")
+    {
+        std::vector<std::thread> threads;
+        for (auto i = 0; i != 4; ++i)
+            threads.emplace_back([&] {
+                for (auto j = 0; j != 100; ++j)
+                    lexy_ext::validate_with_metrics<items>(lexy::zstring_input("abcabc"), metrics,
+                                                           errors);
+            });
+
+        // Taking a snapshot while parsing is allowed.
+        auto partial = metrics.snapshot();
+        CHECK(partial.productions.size() <= 1);
+
+        for (auto& thread : threads)
+            thread.join();
+
+        auto snapshot = metrics.snapshot();
+        REQUIRE(snapshot.productions.size() == 1);
+        CHECK(snapshot.productions[0].parses == 400);
+        CHECK(snapshot.productions[0].bytes == 400 * 6);
+        CHECK(snapshot.productions[0].successes == 400);
+        CHECK(snapshot.errors.empty());
+    }
+}
@@ -297,3 +297,101 @@ TEST_CASE("node_position()")
     REQUIRE(prod_count == 6);
 }
 
+namespace
+{
+using hashed_parse_tree = lexy::hashed_parse_tree_for<lexy::string_input<>, token_kind>;
+
+// Builds a tree of `(a)(b)...` with one child production per parenthesized token.
+hashed_parse_tree build_hashed_tree(const lexy::string_input<>& input)
+{
+    hashed_parse_tree::builder builder(root_p{});
+    for (auto cur = input.begin(); cur != input.end(); cur += 3)
+    {
+        auto child = builder.start_production(child_p{});
+        builder.token(token_kind::b, cur, cur + 1);
+        builder.token(token_kind::c, cur + 1, cur + 2);
+        builder.token(token_kind::b, cur + 2, cur + 3);
+        builder.finish_production(LEXY_MOV(child));
+    }
+    return LEXY_MOV(builder).finish();
+}
+} // namespace
+
+TEST_CASE("diff_subtrees()")
+{
+    auto old_input = lexy::zstring_input("(a)(b)(c)");
+    auto old_tree  = build_hashed_tree(old_input);
+
+    doctest::String result;
+
+    auto diff = [&](const char* str) {
+        auto input = lexy::zstring_input(str);
+        auto tree  = build_hashed_tree(input);
+
+        result = "";
+        lexy_ext::diff_subtrees(old_tree, tree, [&](auto old_node, auto new_node) {
+            auto old_lexeme = old_node.lexeme();
+            auto new_lexeme = new_node.lexeme();
+            result += old_node.kind().name();
+            result += ":";
+            result += doctest::String(old_lexeme.data(), unsigned(old_lexeme.size()));
+            result += "->";
+            result += doctest::String(new_lexeme.data(), unsigned(new_lexeme.size()));
+            result += ";";
+        });
+    };
+
+    diff("(a)(b)(c)");
+    CHECK(result == "");
+
+    diff("(a)(x)(c)");
+    CHECK(result == "token:b->x;");
+
+    diff("(x)(b)[c]");
+    CHECK(result == "token:a->x;token:(->[;token:)->];");
+
+    // A different number of children reports the parent.
+    diff("(a)(b)");
+    CHECK(result == "root_p:->;");
+}
+
+TEST_CASE("subtree_index")
+{
+    auto input_a = lexy::zstring_input("(a)(b)(a)");
+    auto input_b = lexy::zstring_input("(b)(c)");
+    auto tree_a  = build_hashed_tree(input_a);
+    auto tree_b  = build_hashed_tree(input_b);
+
+    lexy_ext::subtree_index<hashed_parse_tree> index;
+    CHECK(index.empty());
+
+    // The second (a) is a duplicate of the first one.
+    CHECK(index.insert(tree_a) == tree_a.root());
+    CHECK(index.size() == 3);
+
+    auto a_children = tree_a.root().children().begin();
+    auto first_a    = *a_children;
+    auto first_b    = *++a_children;
+    auto second_a   = *++a_children;
+    CHECK(index.canonical(first_a) == first_a);
+    CHECK(index.canonical(second_a) == first_a);
+    CHECK(index.canonical(*first_a.children().begin()) == *first_a.children().begin());
+
+    // Only the root and (c) are new.
+    CHECK(index.insert(tree_b) == tree_b.root());
+    CHECK(index.size() == 5);
+
+    auto b_children = tree_b.root().children().begin();
+    auto second_b   = *b_children;
+    auto first_c    = *++b_children;
+    CHECK(index.canonical(second_b) == first_b);
+    CHECK(index.canonical(first_c) == first_c);
+
+    CHECK(index.find(first_b.subtree_hash()) == first_b);
+    CHECK(!index.find(first_b.children().begin()->subtree_hash()));
+
+    index.clear();
+    CHECK(index.empty());
+    CHECK(index.canonical(second_a) == second_a);
+}
+
@@ -0,0 +1,96 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy_ext/static_vector.hpp>
+
+#include <doctest/doctest.h>
+#include <lexy/callback.hpp>
+#include <lexy/dsl.hpp>
+#include <lexy/input/string_input.hpp>
+#include <lexy/parse.hpp>
+
+TEST_CASE("static_vector")
+{
+    lexy_ext::static_vector<int, 4> vec;
+    CHECK(vec.empty());
+    CHECK(vec.capacity() == 4);
+
+    vec.push_back(1);
+    vec.emplace_back(2);
+    CHECK(vec.size() == 2);
+    CHECK(vec[0] == 1);
+    CHECK(vec[1] == 2);
+
+    int data[] = {3, 4};
+    vec.append(data, 2);
+    CHECK(vec.size() == 4);
+    CHECK(vec != lexy_ext::static_vector<int, 4>());
+
+    auto sum = 0;
+    for (auto i : vec)
+        sum += i;
+    CHECK(sum == 10);
+
+    vec.clear();
+    CHECK(vec.empty());
+    CHECK(vec == lexy_ext::static_vector<int, 4>());
+}
+
+namespace
+{
+namespace dsl = lexy::dsl;
+
+using name = lexy_ext::static_vector<char, 16>;
+
+struct entry
+{
+    name key;
+    int  value;
+};
+
+struct entry_p
+{
+    static constexpr auto rule
+        = dsl::identifier(dsl::ascii::alpha) + dsl::lit_c<'='> + dsl::integer<int>(dsl::digits<>);
+    static constexpr auto value = lexy::callback<entry>(
+        [](auto lexeme, int value) { return entry{lexy::as_string<name>(lexeme), value}; });
+};
+
+struct config
+{
+    static constexpr auto whitespace = dsl::ascii::space;
+
+    static constexpr auto rule  = dsl::list(dsl::p<entry_p>, dsl::sep(dsl::comma)) + dsl::eof;
+    static constexpr auto value = lexy::as_list<lexy_ext::static_vector<entry, 8>>;
+};
+
+constexpr auto parse_config(const char* str)
+{
+    return lexy::parse<config>(lexy::zstring_input(str), lexy::noop);
+}
+} // namespace
+
+TEST_CASE("constexpr parse")
+{
+#ifndef LEXY_DISABLE_CONSTEXPR_TESTS
+    static_assert(parse_config("width=80, height=24").is_success());
+
+    constexpr auto entries = parse_config("width=80, height=24").value();
+    static_assert(entries.size() == 2);
+    static_assert(entries[0].key == name("width", 5));
+    static_assert(entries[0].value == 80);
+    static_assert(entries[1].key == name("height", 6));
+    static_assert(entries[1].value == 24);
+
+    constexpr auto error = parse_config("width=80, height");
+    static_assert(!error.is_success());
+    static_assert(error.error_count() == 1);
+#endif
+
+    // It works at runtime as well.
+    auto runtime = parse_config("depth=3");
+    REQUIRE(runtime.is_success());
+    CHECK(runtime.value()[0].key == name("depth", 5));
+    CHECK(runtime.value()[0].value == 3);
+}
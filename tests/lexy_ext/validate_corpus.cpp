@@ -0,0 +1,92 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy_ext/validate_corpus.hpp>
+
+#include <cstdio>
+#include <doctest/doctest.h>
+#include <lexy/dsl/eof.hpp>
+#include <lexy/dsl/list.hpp>
+#include <lexy/dsl/literal.hpp>
+#include <lexy/dsl/sequence.hpp>
+
+namespace
+{
+struct production
+{
+    static constexpr auto rule = list(LEXY_LIT("abc")) + lexy::dsl::eof;
+};
+
+void write_test_data(const std::string& path, const std::string& data)
+{
+    auto file = std::fopen(path.c_str(), "wb");
+    std::fputs(data.c_str(), file);
+    std::fclose(file);
+}
+} // namespace
+
+TEST_CASE("validate_corpus")
+{
+    std::vector<std::string> paths;
+    for (auto i = 0; i != 16; ++i)
+        paths.push_back("lexy-validate-corpus-" + std::to_string(i) + ".test.delete-me");
+
+    for (auto i = 0u; i != paths.size(); ++i)
+    {
+        std::string data;
+        for (auto j = 0u; j != 1 + 100 * i; ++j)
+            data += "abc";
+        // Every fourth file is invalid.
+        if (i % 4 == 3)
+            data += "abd";
+        write_test_data(paths[i], data);
+    }
+    std::remove(paths.back().c_str());
+
+    using input_t           = lexy_ext::corpus_input<>;
+    constexpr auto callback = lexy::collect_compact<std::vector<lexy::compact_error<input_t>>>;
+
+    SUBCASE("single thread")
+    {
+        auto results = lexy_ext::validate_corpus<production>(paths, callback, {1});
+        REQUIRE(results.size() == paths.size());
+        for (auto i = 0u; i != paths.size() - 1; ++i)
+        {
+            CHECK(!results[i].has_file_error());
+            CHECK(results[i].operator bool() == (i % 4 != 3));
+        }
+        CHECK(results.back().has_file_error());
+        CHECK(results.back().file_error() == lexy::file_error::file_not_found);
+    }
+    SUBCASE("multiple threads")
+    {
+        auto results = lexy_ext::validate_corpus<production>(paths, callback, {4});
+        REQUIRE(results.size() == paths.size());
+        for (auto i = 0u; i != paths.size() - 1; ++i)
+        {
+            REQUIRE(!results[i].has_file_error());
+            if (i % 4 == 3)
+            {
+                auto& errors = results[i].result().errors();
+                REQUIRE(errors.size() == 1);
+                CHECK(errors[0].offset() == 3 * (1 + 100 * i));
+                CHECK(errors[0].is<lexy::expected_char_class>());
+            }
+            else
+            {
+                CHECK(results[i]);
+            }
+        }
+        CHECK(results.back().has_file_error());
+    }
+    SUBCASE("empty")
+    {
+        auto results
+            = lexy_ext::validate_corpus<production>(std::vector<const char*>{}, callback);
+        CHECK(results.empty());
+    }
+
+    for (auto& path : paths)
+        std::remove(path.c_str());
+}